@@ -12,11 +12,14 @@ namespace BinaryData
     extern const char*   proaudio_path;
     const int            proaudio_pathSize = 452;
 
+    extern const char*   singing_ogg;
+    const int            singing_oggSize = 19215;
+
     // Points to the start of a list of resource names.
     extern const char* namedResourceList[];
 
     // Number of elements in the namedResourceList array.
-    const int namedResourceListSize = 1;
+    const int namedResourceListSize = 2;
 
     // If you provide the name of one of the binary resource variables above, this function will
     // return the corresponding data and its size (or a null pointer if the name isn't found).
@@ -10,66 +10,210 @@
 #define ANDROIDSYNTHPROCESSOR_H_INCLUDED
 
 #include "../JuceLibraryCode/JuceHeader.h"
+#include "SynthPart.h"
+#include "ParallelPartRenderer.h"
+#include "RecordingAnalyser.h"
+#include "SustainLoopFinder.h"
 
-class AndroidSynthProcessor : public AudioProcessor
+class AndroidSynthProcessor : public AudioProcessor,
+                              private AsyncUpdater
 {
 public:
     AndroidSynthProcessor ()
-        : currentRecording (1, 1)
+        : currentRecording (1, 1),
+          renderer (new ParallelPartRenderer (getDefaultNumRenderThreads()))
     {
         // initialize parameters
         addParameter (isRecordingParam = new AudioParameterBool ("isRecording", "Is Recording", false));
-        addParameter (roomSizeParam = new AudioParameterFloat ("roomSize", "Room Size", 0.0f, 1.0f, 0.5f));
+
+        for (int i = 0; i < maxNumParts; ++i)
+        {
+            // part 1 keeps the original parameter ID so that existing UIs still control it
+            AudioParameterFloat* roomSizeParam = (i == 0 ? new AudioParameterFloat ("roomSize", "Room Size", 0.0f, 1.0f, 0.5f)
+                                                         : new AudioParameterFloat ("roomSize" + String (i + 1),
+                                                                                    "Room Size " + String (i + 1), 0.0f, 1.0f, 0.5f));
+            addParameter (roomSizeParam);
+            parts.add (new SynthPart (i + 1, *roomSizeParam, maxNumVoices));
+        }
+
+        activeParts.ensureStorageAllocated (maxNumParts);
 
         formatManager.registerBasicFormats();
 
-        for (int i = 0; i < maxNumVoices; ++i)
-            synth.addVoice (new SamplerVoice());
+        SynthesiserSound::Ptr defaultSound = loadNewSample (BinaryData::singing_ogg, BinaryData::singing_oggSize, "ogg");
 
-        loadNewSample (BinaryData::singing_ogg, BinaryData::singing_oggSize, "ogg");
+        for (int i = 0; i < parts.size(); ++i)
+            parts.getUnchecked (i)->setSound (defaultSound);
     }
 
     //==============================================================================
-    void prepareToPlay (double sampleRate, int estimatedMaxSizeOfBuffer) override
+    int getNumParts() const noexcept                                            { return parts.size(); }
+
+    /** Selects which part (0-based, i.e. MIDI channel - 1) receives the next recording. */
+    void setRecordingTargetPart (int partIndex) noexcept                        { recordingTargetPart = jlimit (0, maxNumParts - 1, partIndex); }
+    int getRecordingTargetPart() const noexcept                                 { return recordingTargetPart; }
+
+    /** Changes how many worker threads render parts alongside the audio thread.
+        Zero renders every part on the audio thread.
+    */
+    void setNumRenderThreads (int numThreads)
+    {
+        ScopedPointer<ParallelPartRenderer> newRenderer (new ParallelPartRenderer (jlimit (0, maxNumParts - 1, numThreads)));
+
+        {
+            const ScopedLock sl (getCallbackLock());
+            renderer.swapWith (newRenderer);
+        }
+    }
+
+    int getNumRenderThreads() const noexcept                                    { return renderer->getNumWorkerThreads(); }
+
+    /** Gives a part its reverb and output buffer now, rather than when its channel
+        is first played, so that its first notes aren't held back. Must not be
+        called on the audio thread.
+    */
+    void allocatePartStorage (int partIndex)
+    {
+        SynthPart& part = *parts.getUnchecked (partIndex);
+
+        if (part.hasStorage())
+            return;
+
+        ScopedPointer<SynthPart::Storage> storage (part.createStorage());
+
+        {
+            const ScopedLock sl (getCallbackLock());
+            part.swapStorage (storage);
+        }
+    }
+
+    //==============================================================================
+    /** Sets the format in which samples loaded or recorded from now on are kept in memory. */
+    void setSampleFormat (SampleData::Format newFormat) noexcept                { sampleFormat = newFormat; }
+    SampleData::Format getSampleFormat() const noexcept                         { return sampleFormat; }
+
+    /** Returns the number of bytes of sample data held by all the parts' sounds. */
+    size_t getSampleMemoryInBytes() const
+    {
+        Array<const SynthesiserSound*> counted;
+        size_t total = 0;
+
+        for (int i = 0; i < parts.size(); ++i)
+        {
+            const SynthesiserSound::Ptr sound (parts.getUnchecked (i)->getSound());
+
+            if (const CompactSamplerSound* compactSound = dynamic_cast<const CompactSamplerSound*> (sound.get()))
+            {
+                if (! counted.contains (compactSound))
+                {
+                    counted.add (compactSound);
+                    total += compactSound->getSizeInBytes();
+                }
+            }
+        }
+
+        return total;
+    }
+
+    /** Changes how new recordings are trimmed and normalised before they're installed. */
+    void setRecordingAnalyserSettings (const RecordingAnalyser::Settings& newSettings)      { analyserSettings = newSettings; }
+    const RecordingAnalyser::Settings& getRecordingAnalyserSettings() const noexcept        { return analyserSettings; }
+
+    /** Returns where the useful signal was found in the most recent recording. */
+    const RecordingAnalyser::Result& getLastRecordingAnalysis() const noexcept              { return lastAnalysis; }
+
+    /** Changes how sustain loops are found in new recordings, or turns them off. */
+    void setSustainLoopSettings (const SustainLoopFinder::Settings& newSettings)             { loopSettings = newSettings; }
+    const SustainLoopFinder::Settings& getSustainLoopSettings() const noexcept              { return loopSettings; }
+
+    /** Sets the ADSR envelope that new recordings are played with. */
+    void setRecordingEnvelope (const VoiceEnvelopeBank::Parameters& newEnvelope)            { recordingEnvelope = newEnvelope; }
+    const VoiceEnvelopeBank::Parameters& getRecordingEnvelope() const noexcept              { return recordingEnvelope; }
+
+    /** Returns the occupancy of the pool that recording buffers and recorded sounds are allocated from. */
+    SampleBufferPool::Stats getSampleBufferPoolStats() const noexcept
     {
-        ignoreUnused (estimatedMaxSizeOfBuffer);
+        if (samplePool != nullptr)
+            return samplePool->getStats();
+
+        SampleBufferPool::Stats noStats = { 0, 0, 0, 0, 0 };
+        return noStats;
+    }
+
+    //==============================================================================
+    bool isRecording() const noexcept                                           { return isRecordingParam->get(); }
+
+    /** The peaks of the recording in progress, which grow as it's recorded. */
+    const WaveformPeaks& getRecordingPeaks() const noexcept                     { return recordingPeaks; }
 
+    SynthesiserSound::Ptr getPartSound (int partIndex) const                    { return parts.getUnchecked (partIndex)->getSound(); }
+
+    /** Copies the sample positions of a part's playing voices into dest, and returns how many there were. */
+    int getPartPlayheadPositions (int partIndex, int* dest, int maxPositions) const noexcept
+    {
+        return parts.getUnchecked (partIndex)->getPlayheadPositions (dest, maxPositions);
+    }
+
+    /** Returns the smoothed fraction of the available block time spent in processBlock. */
+    float getRenderLoad() const noexcept                                        { return renderLoad.get(); }
+
+    //==============================================================================
+    void prepareToPlay (double sampleRate, int estimatedMaxSizeOfBuffer) override
+    {
         lastSampleRate = sampleRate;
 
-        currentRecording.setSize (1, static_cast<int> (std::ceil (kMaxDurationOfRecording * lastSampleRate)));
+        prepareRecordingBuffer (static_cast<int> (std::ceil (kMaxDurationOfRecording * lastSampleRate)));
         samplesRecorded = 0;
 
-        synth.setCurrentPlaybackSampleRate (lastSampleRate);
-        reverb.setSampleRate (lastSampleRate);
+        for (int i = 0; i < parts.size(); ++i)
+            parts.getUnchecked (i)->prepareToPlay (lastSampleRate, estimatedMaxSizeOfBuffer, jmax (1, getNumOutputChannels()));
+
+        activePartMask = 0;
+        waitingPartMask = 0;
     }
 
     void processBlock (AudioBuffer<float>& buffer, MidiBuffer& midiMessages) override
     {
+        const int64 startTicks = Time::getHighResolutionTicks();
+
         if (isRecordingParam->get())
         {
+            if (samplesRecorded == 0)
+                recordingPeaks.clear();
+
             int len = std::min (currentRecording.getNumSamples() - samplesRecorded, buffer.getNumSamples());
             currentRecording.copyFrom (0, samplesRecorded, buffer.getReadPointer (0), len, 1.0f);
+            recordingPeaks.addSamples (buffer.getReadPointer (0), len);
             samplesRecorded += len;
             if (samplesRecorded >= currentRecording.getNumSamples())
             {
                 samplesRecorded = 0;
                 isRecordingParam->setValueNotifyingHost (0.0f);
-                MessageManager::callAsync ([this] { swapSamples(); });
+                recordingFinished.set (1);
+                triggerAsyncUpdate();
             }
         }
 
         buffer.clear();
 
-        Reverb::Parameters reverbParameters;
-        reverbParameters.roomSize = roomSizeParam->get();
+        routeMidiToParts (midiMessages);
+        renderActiveParts (buffer);
 
-        reverb.setParameters (reverbParameters);
-        synth.renderNextBlock (buffer, midiMessages, 0, buffer.getNumSamples());
-        reverb.processMono (buffer.getWritePointer (0), buffer.getNumSamples());
+        updateRenderLoad (Time::highResolutionTicksToSeconds (Time::getHighResolutionTicks() - startTicks), buffer.getNumSamples());
     }
 
     //==============================================================================
-    void releaseResources() override                                            { currentRecording.setSize (1, 1); }
+    void releaseResources() override
+    {
+        currentRecording.setSize (1, 1);
+        recordingStorage.free();
+
+        for (int i = 0; i < parts.size(); ++i)
+            parts.getUnchecked (i)->releaseResources();
+
+        activePartMask = 0;
+        waitingPartMask = 0;
+    }
 
     //==============================================================================
     const String getInputChannelName (int channelIndex) const override          { return String (channelIndex + 1); }
@@ -100,53 +244,246 @@ public:
     void setStateInformation (const void*, int) override                        {}
 private:
     //==============================================================================
-    void loadNewSample (const void* data, int dataSize, const char* format)
+    void routeMidiToParts (const MidiBuffer& midiMessages)
+    {
+        // parts whose storage has arrived can now play the events they've been holding
+        for (uint32 mask = waitingPartMask; mask != 0; mask &= (mask - 1))
+        {
+            const uint32 bit = mask & (~mask + 1);
+
+            if (parts.getUnchecked (countTrailingZeros (mask))->hasStorage())
+            {
+                activePartMask |= bit;
+                waitingPartMask &= ~bit;
+            }
+        }
+
+        MidiBuffer::Iterator it (midiMessages);
+        MidiMessage message;
+        int samplePosition;
+        bool needsStorage = false;
+
+        while (it.getNextEvent (message, samplePosition))
+        {
+            const int channel = message.getChannel();
+
+            if (channel > 0)
+            {
+                if (parts.getUnchecked (channel - 1)->addEvent (message, samplePosition))
+                {
+                    activePartMask |= (1u << (channel - 1));
+                }
+                else
+                {
+                    waitingPartMask |= (1u << (channel - 1));
+                    needsStorage = true;
+                }
+            }
+        }
+
+        if (needsStorage)
+            triggerAsyncUpdate();
+    }
+
+    void renderActiveParts (AudioBuffer<float>& buffer)
+    {
+        const int numSamples = buffer.getNumSamples();
+
+        activeParts.clearQuick();
+
+        for (uint32 mask = activePartMask; mask != 0; mask &= (mask - 1))
+            activeParts.add (parts.getUnchecked (countTrailingZeros (mask)));
+
+        renderer->render (activeParts.getRawDataPointer(), activeParts.size(), numSamples);
+
+        // sum in part order so that the result is the same whatever thread rendered each part
+        for (int i = 0; i < activeParts.size(); ++i)
+        {
+            SynthPart& part = *activeParts.getUnchecked (i);
+            const AudioBuffer<float>& partOutput = part.getOutput();
+
+            for (int ch = jmin (buffer.getNumChannels(), partOutput.getNumChannels()); --ch >= 0;)
+                buffer.addFrom (ch, 0, partOutput, ch, 0, numSamples);
+
+            if (part.isIdle())
+                activePartMask &= ~(1u << (part.getMidiChannel() - 1));
+        }
+    }
+
+    void updateRenderLoad (double secondsElapsed, int numSamples)
+    {
+        if (numSamples > 0 && lastSampleRate > 0)
+        {
+            const float load = static_cast<float> (secondsElapsed * lastSampleRate / numSamples);
+            renderLoad = renderLoad.get() + (load - renderLoad.get()) * kRenderLoadSmoothing;
+        }
+    }
+
+    static int countTrailingZeros (uint32 mask) noexcept
+    {
+        int n = 0;
+
+        while ((mask & 1) == 0)
+        {
+            mask >>= 1;
+            ++n;
+        }
+
+        return n;
+    }
+
+    static int getDefaultNumRenderThreads()
+    {
+        return jlimit (0, maxNumParts - 1, SystemStats::getNumCpus() - 1);
+    }
+
+    //==============================================================================
+    SynthesiserSound::Ptr loadNewSample (const void* data, int dataSize, const char* format)
     {
         MemoryInputStream* soundBuffer = new MemoryInputStream (data, static_cast<std::size_t> (dataSize), false);
         ScopedPointer<AudioFormatReader> formatReader (formatManager.findFormatForFileExtension (format)->createReaderFor (soundBuffer, true));
 
         BigInteger midiNotes;
         midiNotes.setRange (0, 126, true);
-        SynthesiserSound::Ptr newSound = new SamplerSound ("Voice", *formatReader, midiNotes, 0x40, 0.0, 0.0, 10.0);
+        return CompactSamplerSound::createFromReader ("Voice", *formatReader, midiNotes, 0x40, 0.0, 0.0, 10.0, sampleFormat);
+    }
 
-        synth.removeSound (0);
-        sound = newSound;
-        synth.addSound (sound);
+    void handleAsyncUpdate() override
+    {
+        for (int i = 0; i < parts.size(); ++i)
+            if (parts.getUnchecked (i)->needsStorage())
+                allocatePartStorage (i);
+
+        if (recordingFinished.compareAndSetBool (0, 1))
+            swapSamples();
     }
 
     void swapSamples()
     {
-        MemoryBlock mb;
-        MemoryOutputStream* stream = new MemoryOutputStream (mb, true);
+        lastAnalysis = RecordingAnalyser::analyse (currentRecording.getReadPointer (0), currentRecording.getNumSamples(),
+                                                   lastSampleRate, analyserSettings);
+
+        // a recording with nothing in it leaves the part's current sound alone
+        if (lastAnalysis.isSilent)
+            return;
+
+        RecordingAnalyser::process (currentRecording, lastAnalysis, lastSampleRate, analyserSettings);
+
+        // with a sustain loop, nothing after the loop end is ever played
+        const SustainLoopFinder::LoopPoints loop = SustainLoopFinder::find (currentRecording.getReadPointer (0, lastAnalysis.startSample),
+                                                                            lastAnalysis.numSamples, lastSampleRate, loopSettings);
+        int numSamplesToKeep = lastAnalysis.numSamples;
 
+        if (loop.isValid)
         {
-            ScopedPointer<AudioFormatWriter> writer (formatManager.findFormatForFileExtension ("wav")->createWriterFor (stream, lastSampleRate, 1, 16,
-                                                                                                                        StringPairArray(), 0));
-            writer->writeFromAudioSampleBuffer (currentRecording, 0, currentRecording.getNumSamples());
-            writer->flush();
-            stream->flush();
+            SustainLoopFinder::applyCrossfade (currentRecording.getWritePointer (0, lastAnalysis.startSample), loop);
+            numSamplesToKeep = loop.end + 1;
         }
 
-        loadNewSample (mb.getData(), static_cast<int> (mb.getSize()), "wav");
+        CompactSamplerSound* sound = getUnusedRecordingSound();
+        sound->setSamples (currentRecording, lastAnalysis.startSample, numSamplesToKeep, lastSampleRate, sampleFormat);
+
+        if (loop.isValid)
+            sound->setSustainLoop (loop.start, loop.end);
+
+        sound->setEnvelopeParameters (recordingEnvelope);
+
+        parts.getUnchecked (recordingTargetPart)->setSound (sound);
     }
 
     //==============================================================================
+    /** (Re)allocates the recording buffer from the sample pool, replacing the pool
+        with a new one if its slots are too small for a recording at this rate.
+    */
+    void prepareRecordingBuffer (int numSamples)
+    {
+        const size_t slotSize = SampleData::getMaxSizeInBytes (numSamples);
+
+        if (samplePool == nullptr || samplePool->getSlotSize() < slotSize)
+        {
+            currentRecording.setSize (1, 1);
+            recordingStorage.free();
+
+            // sounds that are still playing keep the old pool alive until they're released
+            recordingSounds.clear();
+            samplePool = new SampleBufferPool (slotSize, kSampleArenaBudgetInBytes);
+
+            for (int i = 0; i < kNumRecordingSounds; ++i)
+                recordingSounds.add (createRecordingSound (numSamples));
+        }
+
+        recordingStorage.ensureSize (samplePool, sizeof (float) * static_cast<size_t> (numSamples));
+        recordingChannels[0] = static_cast<float*> (recordingStorage.getData());
+        currentRecording.setDataToReferTo (recordingChannels, 1, numSamples);
+
+        recordingPeaks.setMaxNumSamples (numSamples);
+    }
+
+    /** Creates a sound for recordings of up to maxNumSamples. Its sample data
+        comes from the pool, and its peaks are sized up front, so refilling it
+        with any recording doesn't allocate.
+    */
+    CompactSamplerSound* createRecordingSound (int maxNumSamples) const
+    {
+        BigInteger midiNotes;
+        midiNotes.setRange (0, 126, true);
+
+        CompactSamplerSound* const sound = new CompactSamplerSound ("Recording", midiNotes, 0x40, 0.0, 0.0, samplePool);
+        sound->reservePeaks (maxNumSamples);
+        return sound;
+    }
+
+    /** Returns a recording sound that no part or voice is using any more, so that
+        its storage can be refilled in place.
+    */
+    CompactSamplerSound* getUnusedRecordingSound()
+    {
+        for (int i = 0; i < recordingSounds.size(); ++i)
+            if (recordingSounds.getObjectPointerUnchecked (i)->getReferenceCount() == 1)
+                return recordingSounds.getObjectPointerUnchecked (i);
+
+        return recordingSounds.add (createRecordingSound (currentRecording.getNumSamples()));
+    }
+
+    //==============================================================================
+    static constexpr int maxNumParts = 16;
     static constexpr int maxNumVoices = 5;
     static constexpr double kMaxDurationOfRecording = 1.0;
+    static constexpr float kRenderLoadSmoothing = 0.05f;
+    static constexpr size_t kSampleArenaBudgetInBytes = 4 * 1024 * 1024;
+    static constexpr int kNumRecordingSounds = maxNumParts + 2;
 
     //==============================================================================
     AudioFormatManager formatManager;
 
     int samplesRecorded;
-    double lastSampleRate;
+    double lastSampleRate = 0.0;
     AudioBuffer<float> currentRecording;
 
-    Reverb reverb;
-    Synthesiser synth;
-    SynthesiserSound::Ptr sound;
+    SampleBufferPool::Ptr samplePool;
+    PooledSampleBuffer recordingStorage;
+    WaveformPeaks recordingPeaks;
+    float* recordingChannels[1];
+    ReferenceCountedArray<CompactSamplerSound> recordingSounds;
+
+    OwnedArray<SynthPart> parts;
+    Array<SynthPart*> activeParts;
+    uint32 activePartMask = 0;
+    uint32 waitingPartMask = 0;     // parts holding events until they have storage
+    Atomic<int> recordingFinished;
+    int recordingTargetPart = 0;
+
+    ScopedPointer<ParallelPartRenderer> renderer;
+
+    SampleData::Format sampleFormat = SampleData::int16Samples;
+    Atomic<float> renderLoad;
+
+    RecordingAnalyser::Settings analyserSettings;
+    SustainLoopFinder::Settings loopSettings;
+    VoiceEnvelopeBank::Parameters recordingEnvelope;
+    RecordingAnalyser::Result lastAnalysis = { 0, 0, 0.0f, true };
 
     AudioParameterBool* isRecordingParam;
-    AudioParameterFloat* roomSizeParam;
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (AndroidSynthProcessor)
 };
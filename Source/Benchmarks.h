@@ -0,0 +1,309 @@
+/*
+  ==============================================================================
+
+    Copyright (c) 2015 - ROLI Ltd.
+
+  ==============================================================================
+*/
+
+#ifndef BENCHMARKS_H_INCLUDED
+#define BENCHMARKS_H_INCLUDED
+
+#include "CompactSampler.h"
+#include "MainComponent.h"
+#include "MaterialLookAndFeel.h"
+
+//==============================================================================
+/** Offline measurements of the synth's hot paths, run with --benchmark.
+
+    Everything is rendered headlessly at a fixed sample rate and block size, so
+    the numbers from different builds and devices can be compared directly.
+*/
+class SynthBenchmarks
+{
+public:
+    //==============================================================================
+    static void runAll()
+    {
+        runSampleStorageBenchmark();
+        runVoiceKernelBenchmark();
+        runEnvelopeBenchmark();
+        runUiRenderBenchmark();
+    }
+
+    //==============================================================================
+    /** Reports the memory used by the built-in sample in each storage format,
+        and the time taken to render a block of voices playing it.
+    */
+    static void runSampleStorageBenchmark()
+    {
+        Logger::writeToLog ("Sample storage (" + String (kNumVoices) + " voices, "
+                              + String (kBlockSize) + " sample blocks):");
+
+        AudioFormatManager formatManager;
+        formatManager.registerBasicFormats();
+
+        const SampleData::Format formats[] = { SampleData::float32Samples, SampleData::int16Samples, SampleData::compressedSamples };
+        const char* const formatNames[] = { "float32", "int16", "compressed" };
+
+        for (int i = 0; i < numElementsInArray (formats); ++i)
+        {
+            ScopedPointer<AudioFormatReader> reader (formatManager.findFormatForFileExtension ("ogg")
+                                                       ->createReaderFor (new MemoryInputStream (BinaryData::singing_ogg,
+                                                                                                 BinaryData::singing_oggSize,
+                                                                                                 false), true));
+            BigInteger midiNotes;
+            midiNotes.setRange (0, 126, true);
+
+            ReferenceCountedObjectPtr<CompactSamplerSound> sound (CompactSamplerSound::createFromReader ("Voice", *reader, midiNotes, 0x40,
+                                                                                                      0.0, 0.0, 10.0, formats[i]));
+            const double secondsPerBlock = timeRendering (sound.get());
+
+            Logger::writeToLog (String (formatNames[i]).paddedRight (' ', 12)
+                                  + String (static_cast<int64> (sound->getSizeInBytes())) + " bytes, "
+                                  + String (secondsPerBlock * 1.0e6, 2) + " us per block ("
+                                  + String (100.0 * secondsPerBlock * kSampleRate / kBlockSize, 2) + "% CPU)");
+        }
+    }
+
+    //==============================================================================
+    /** Times every specialised voice kernel against the generic per-sample loop
+        doing the same job, and checks that both produce the same output.
+    */
+    static void runVoiceKernelBenchmark()
+    {
+        Logger::writeToLog ("Voice kernels vs generic loop (ns per sample):");
+
+        const int sourceLength = 2 * kBlockSize + 2;
+        AudioBuffer<float> source (2, sourceLength);
+        Random random (0x1234);
+
+        for (int ch = 0; ch < source.getNumChannels(); ++ch)
+            for (int i = 0; i < sourceLength; ++i)
+                source.setSample (ch, i, random.nextFloat() * 2.0f - 1.0f);
+
+        AudioBuffer<float> kernelOutput (2, kBlockSize), genericOutput (2, kBlockSize);
+        HeapBlock<float> envelopeRamp (static_cast<size_t> (kBlockSize));
+
+        for (int i = 0; i < kBlockSize; ++i)
+            envelopeRamp[i] = i / static_cast<float> (kBlockSize);
+
+        for (int numSourceChannels = 1; numSourceChannels <= 2; ++numSourceChannels)
+        {
+            for (int numOutputChannels = 1; numOutputChannels <= 2; ++numOutputChannels)
+            {
+                for (int i = 0; i < VoiceRenderKernels::numInterpolationTypes; ++i)
+                {
+                    for (int e = 0; e < VoiceRenderKernels::numEnvelopeStages; ++e)
+                    {
+                        const VoiceRenderKernels::Interpolation interpolation = static_cast<VoiceRenderKernels::Interpolation> (i);
+                        const VoiceRenderKernels::EnvelopeStage envelope = static_cast<VoiceRenderKernels::EnvelopeStage> (e);
+
+                        VoiceRenderKernels::Params params;
+                        params.inL = source.getReadPointer (0);
+                        params.inR = source.getReadPointer (1);
+                        params.position = (interpolation == VoiceRenderKernels::noInterpolation ? 0.0 : 0.25);
+                        params.pitchRatio = (interpolation == VoiceRenderKernels::noInterpolation ? 1.0 : 1.5);
+                        params.gainL = params.gainR = 0.8f;
+                        params.level = 1.0f;
+                        params.levels = envelopeRamp;
+
+                        const VoiceRenderKernels::Kernel kernel = VoiceRenderKernels::getKernel (numSourceChannels, numOutputChannels,
+                                                                                                 interpolation, envelope);
+                        int64 kernelTicks = 0, genericTicks = 0;
+
+                        for (int block = 0; block < kNumBlocks; ++block)
+                        {
+                            kernelOutput.clear();
+                            genericOutput.clear();
+
+                            params.outL = kernelOutput.getWritePointer (0);
+                            params.outR = kernelOutput.getWritePointer (1);
+
+                            int64 startTicks = Time::getHighResolutionTicks();
+                            kernel (params, kBlockSize);
+                            kernelTicks += Time::getHighResolutionTicks() - startTicks;
+
+                            params.outL = genericOutput.getWritePointer (0);
+                            params.outR = genericOutput.getWritePointer (1);
+
+                            startTicks = Time::getHighResolutionTicks();
+                            VoiceRenderKernels::renderGeneric (params, kBlockSize, numSourceChannels, numOutputChannels, interpolation, envelope);
+                            genericTicks += Time::getHighResolutionTicks() - startTicks;
+                        }
+
+                        float maxError = 0.0f;
+
+                        for (int ch = 0; ch < numOutputChannels; ++ch)
+                            for (int n = 0; n < kBlockSize; ++n)
+                                maxError = jmax (maxError, std::abs (kernelOutput.getSample (ch, n) - genericOutput.getSample (ch, n)));
+
+                        const double nsPerSample = 1.0e9 / (static_cast<double> (kNumBlocks) * kBlockSize);
+                        const double kernelTime = Time::highResolutionTicksToSeconds (kernelTicks) * nsPerSample;
+                        const double genericTime = Time::highResolutionTicksToSeconds (genericTicks) * nsPerSample;
+
+                        Logger::writeToLog ("  " + String (numSourceChannels) + " -> " + String (numOutputChannels) + " ch, "
+                                              + (interpolation == VoiceRenderKernels::noInterpolation ? "no interpolation, " : "linear, ")
+                                              + (envelope == VoiceRenderKernels::envelopeGains ? "gains:    " : "constant: ")
+                                              + String (kernelTime, 2) + " vs " + String (genericTime, 2)
+                                              + " (x" + String (genericTime / jmax (1.0e-9, kernelTime), 2) + ")"
+                                              + ", max difference " + String (maxError));
+                    }
+                }
+            }
+        }
+    }
+
+    //==============================================================================
+    /** Times the envelope bank processing a full set of voices whose notes are
+        staggered so that every stage of the envelope is in use in each block.
+    */
+    static void runEnvelopeBenchmark()
+    {
+        VoiceEnvelopeBank bank;
+        bank.setNumVoices (kNumEnvelopeVoices, kBlockSize);
+
+        VoiceEnvelopeBank::Parameters params;
+        params.attackSeconds = 0.01;
+        params.decaySeconds = 0.2;
+        params.sustainLevel = 0.5f;
+        params.releaseSeconds = 0.3;
+
+        const int notePeriod = 2 * kBlocksBetweenNotes;
+        int64 totalTicks = 0;
+
+        for (int block = 0; block < kNumBlocks; ++block)
+        {
+            for (int voice = 0; voice < kNumEnvelopeVoices; ++voice)
+            {
+                const int phase = (block + voice) % notePeriod;
+
+                if (phase == 0)
+                    bank.noteOn (voice, params, kSampleRate);
+                else if (phase == kBlocksBetweenNotes + kBlocksBetweenNotes / 2)
+                    bank.noteOff (voice);
+            }
+
+            const int64 startTicks = Time::getHighResolutionTicks();
+            bank.process (kBlockSize);
+            totalTicks += Time::getHighResolutionTicks() - startTicks;
+        }
+
+        const double nsPerVoiceSample = Time::highResolutionTicksToSeconds (totalTicks) * 1.0e9
+                                          / (static_cast<double> (kNumBlocks) * kBlockSize * kNumEnvelopeVoices);
+
+        Logger::writeToLog ("Envelope bank (" + String (kNumEnvelopeVoices) + " voices): "
+                              + String (nsPerVoiceSample, 3) + " ns per voice per sample");
+    }
+
+    //==============================================================================
+    /** Paints the main component into an offscreen image with the software
+        renderer, with and without the look-and-feel's image cache. A full frame
+        is what a resize or first paint costs. A slider frame is only the
+        slider's area, which is all that's repainted when the slider moves.
+    */
+    static void runUiRenderBenchmark()
+    {
+        Logger::writeToLog ("UI frames (" + String (kUiWidth) + "x" + String (kUiHeight) + " at "
+                              + String (kUiScale, 1) + "x, software renderer, us per frame):");
+
+        AudioProcessorPlayer player;
+        MaterialLookAndFeel lookAndFeel;
+        MainContentComponent component (player);
+
+        component.setLookAndFeel (&lookAndFeel);
+        component.setSize (kUiWidth, kUiHeight);
+
+        Rectangle<int> sliderArea;
+
+        for (int i = 0; i < component.getNumChildComponents(); ++i)
+            if (Slider* slider = dynamic_cast<Slider*> (component.getChildComponent (i)))
+                sliderArea = slider->getBoundsInParent();
+
+        Image frame (Image::RGB, roundToInt (kUiWidth * kUiScale), roundToInt (kUiHeight * kUiScale), true);
+
+        for (int cached = 0; cached < 2; ++cached)
+        {
+            lookAndFeel.setImageCachingEnabled (cached != 0);
+
+            const double fullFrame   = timeUiFrames (component, frame, component.getLocalBounds());
+            const double sliderFrame = timeUiFrames (component, frame, sliderArea);
+
+            Logger::writeToLog (String (cached != 0 ? "  cached:   " : "  uncached: ")
+                                  + "full " + String (fullFrame * 1.0e6, 1)
+                                  + ", slider " + String (sliderFrame * 1.0e6, 1));
+        }
+
+        component.setLookAndFeel (nullptr);
+    }
+
+private:
+    //==============================================================================
+    static constexpr double kSampleRate = 44100.0;
+    static constexpr int kBlockSize = 512;
+    static constexpr int kNumBlocks = 2000;
+    static constexpr int kNumVoices = 5;
+    static constexpr int kBlocksBetweenNotes = 20;
+    static constexpr int kNumEnvelopeVoices = 64;
+
+    static constexpr int kUiWidth = 600;
+    static constexpr int kUiHeight = 400;
+    static constexpr float kUiScale = 2.0f;
+    static constexpr int kNumUiFrames = 200;
+
+    //==============================================================================
+    /** Returns the average time taken to paint the given area of the component. */
+    static double timeUiFrames (Component& component, Image& frame, Rectangle<int> area)
+    {
+        int64 totalTicks = 0;
+
+        for (int i = 0; i < kNumUiFrames; ++i)
+        {
+            const int64 startTicks = Time::getHighResolutionTicks();
+
+            {
+                Graphics g (frame);
+                g.addTransform (AffineTransform::scale (kUiScale));
+                g.reduceClipRegion (area);
+                component.paintEntireComponent (g, false);
+            }
+
+            totalTicks += Time::getHighResolutionTicks() - startTicks;
+        }
+
+        return Time::highResolutionTicksToSeconds (totalTicks) / kNumUiFrames;
+    }
+
+    //==============================================================================
+    /** Returns the average time taken to render one block of kNumVoices notes. */
+    static double timeRendering (SynthesiserSound* sound)
+    {
+        CompactSynthesiser synth (kNumVoices);
+
+        synth.addSound (sound);
+        synth.setCurrentPlaybackSampleRate (kSampleRate);
+
+        AudioBuffer<float> buffer (1, kBlockSize);
+        MidiBuffer noteOns, noMidi;
+
+        for (int i = 0; i < kNumVoices; ++i)
+            noteOns.addEvent (MidiMessage::noteOn (1, 0x3c + 3 * i, 0.8f), 0);
+
+        int64 totalTicks = 0;
+
+        for (int block = 0; block < kNumBlocks; ++block)
+        {
+            buffer.clear();
+
+            const int64 startTicks = Time::getHighResolutionTicks();
+            synth.renderNextBlock (buffer, (block % kBlocksBetweenNotes) == 0 ? noteOns : noMidi, 0, kBlockSize);
+            totalTicks += Time::getHighResolutionTicks() - startTicks;
+        }
+
+        return Time::highResolutionTicksToSeconds (totalTicks) / kNumBlocks;
+    }
+
+    JUCE_DECLARE_NON_COPYABLE (SynthBenchmarks)
+};
+
+#endif // BENCHMARKS_H_INCLUDED
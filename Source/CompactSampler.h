@@ -0,0 +1,480 @@
+/*
+  ==============================================================================
+
+    Copyright (c) 2015 - ROLI Ltd.
+
+  ==============================================================================
+*/
+
+#ifndef COMPACTSAMPLER_H_INCLUDED
+#define COMPACTSAMPLER_H_INCLUDED
+
+#include "SampleData.h"
+#include "VoiceRenderKernels.h"
+#include "VoiceEnvelopeBank.h"
+#include "WaveformPeaks.h"
+
+//==============================================================================
+/** A sampler sound like JUCE's SamplerSound, but whose sample data is kept in
+    one of the SampleData formats rather than always as 32-bit floats.
+*/
+class CompactSamplerSound   : public SynthesiserSound
+{
+public:
+    //==============================================================================
+    /** Creates a sound with no sample data yet; call setSamples() to fill it.
+        Its sample data is allocated from the given pool, or from the heap if
+        the pool is null.
+    */
+    CompactSamplerSound (const String& soundName,
+                         const BigInteger& notes,
+                         int midiNoteForNormalPitch,
+                         double attackTimeSecs,
+                         double releaseTimeSecs,
+                         SampleBufferPool* poolToUse = nullptr)
+        : name (soundName),
+          pool (poolToUse),
+          midiNotes (notes),
+          midiRootNote (midiNoteForNormalPitch)
+    {
+        channels.ensureStorageAllocated (2);
+
+        envelope.attackSeconds = attackTimeSecs;
+        envelope.releaseSeconds = releaseTimeSecs;
+    }
+
+    CompactSamplerSound (const String& soundName,
+                         const AudioBuffer<float>& source,
+                         int numSamplesToUse,
+                         double sourceSampleRateToUse,
+                         const BigInteger& notes,
+                         int midiNoteForNormalPitch,
+                         double attackTimeSecs,
+                         double releaseTimeSecs,
+                         SampleData::Format format,
+                         SampleBufferPool* poolToUse = nullptr)
+        : CompactSamplerSound (soundName, notes, midiNoteForNormalPitch, attackTimeSecs, releaseTimeSecs, poolToUse)
+    {
+        setSamples (source, 0, numSamplesToUse, sourceSampleRateToUse, format);
+    }
+
+    //==============================================================================
+    /** Replaces the sample data with a range of the source buffer, reusing the
+        existing storage where possible. This must only be called while no
+        synthesiser or voice refers to the sound.
+    */
+    void setSamples (const AudioBuffer<float>& source, int startSample, int numSamplesToUse,
+                     double sourceSampleRateToUse, SampleData::Format format)
+    {
+        jassert (getReferenceCount() <= 1);
+        jassert (startSample >= 0);
+
+        const int numChannels = jmin (2, source.getNumChannels());
+
+        sourceSampleRate = sourceSampleRateToUse;
+        length = jlimit (0, source.getNumSamples() - startSample, numSamplesToUse);
+
+        while (channels.size() < numChannels)
+            channels.add (new SampleData (pool));
+
+        channels.removeRange (numChannels, channels.size());
+
+        for (int ch = 0; ch < numChannels; ++ch)
+            channels.getUnchecked (ch)->setSamples (source.getReadPointer (ch, startSample), length, format);
+
+        if (numChannels > 0)
+            peaks.setSamples (source.getReadPointer (0, startSample), length);
+        else
+            peaks.clear();
+
+        loopStart = loopEnd = 0;
+    }
+
+    /** Allocates room for the peaks of up to this many samples, so that later
+        calls to setSamples() which fit don't need to allocate.
+    */
+    void reservePeaks (int maxNumSamples)
+    {
+        jassert (getReferenceCount() <= 1);
+        peaks.reserve (maxNumSamples);
+    }
+
+    /** Makes notes loop between these sample positions for as long as they're
+        held, and while they release. The sample at loopEndSample must already be
+        a copy of the one at loopStartSample (see SustainLoopFinder), as voices
+        interpolate across the wrap without looking back to the loop start.
+    */
+    void setSustainLoop (int loopStartSample, int loopEndSample) noexcept
+    {
+        jassert (getReferenceCount() <= 1);
+        jassert (loopStartSample >= 0 && loopStartSample < loopEndSample && loopEndSample < length);
+
+        loopStart = loopStartSample;
+        loopEnd = loopEndSample;
+    }
+
+    bool hasSustainLoop() const noexcept                            { return loopEnd > loopStart; }
+    int getLoopStart() const noexcept                               { return loopStart; }
+    int getLoopEnd() const noexcept                                 { return loopEnd; }
+
+    /** Sets the ADSR envelope that notes started from now on will use. */
+    void setEnvelopeParameters (const VoiceEnvelopeBank::Parameters& newParameters) noexcept
+    {
+        jassert (getReferenceCount() <= 1);
+        envelope = newParameters;
+    }
+
+    const VoiceEnvelopeBank::Parameters& getEnvelopeParameters() const noexcept { return envelope; }
+
+    //==============================================================================
+    /** Reads up to maxSampleLengthSeconds from the reader and stores it in the given format. */
+    static CompactSamplerSound* createFromReader (const String& soundName,
+                                                  AudioFormatReader& source,
+                                                  const BigInteger& notes,
+                                                  int midiNoteForNormalPitch,
+                                                  double attackTimeSecs,
+                                                  double releaseTimeSecs,
+                                                  double maxSampleLengthSeconds,
+                                                  SampleData::Format format)
+    {
+        if (source.sampleRate <= 0 || source.lengthInSamples <= 0)
+            return nullptr;
+
+        const int numSamples = static_cast<int> (jmin ((int64) source.lengthInSamples,
+                                                       (int64) (maxSampleLengthSeconds * source.sampleRate)));
+
+        AudioBuffer<float> buffer (jmin (2, static_cast<int> (source.numChannels)), numSamples);
+        source.read (&buffer, 0, numSamples, 0, true, true);
+
+        return new CompactSamplerSound (soundName, buffer, numSamples, source.sampleRate, notes,
+                                        midiNoteForNormalPitch, attackTimeSecs, releaseTimeSecs, format);
+    }
+
+    //==============================================================================
+    const String& getName() const noexcept                          { return name; }
+    int getNumChannels() const noexcept                             { return channels.size(); }
+    int getLength() const noexcept                                  { return length; }
+    SampleData::Format getFormat() const noexcept                   { return channels.size() > 0 ? channels.getUnchecked (0)->getFormat() : SampleData::float32Samples; }
+
+    const SampleData& getChannel (int channel) const noexcept       { return *channels.getUnchecked (channel); }
+
+    /** The peaks of the first channel, for drawing the sound's waveform. */
+    const WaveformPeaks& getPeaks() const noexcept                  { return peaks; }
+
+    /** Returns the number of bytes used by the sample data of all channels. */
+    size_t getSizeInBytes() const noexcept
+    {
+        size_t total = 0;
+
+        for (int i = 0; i < channels.size(); ++i)
+            total += channels.getUnchecked (i)->getSizeInBytes();
+
+        return total;
+    }
+
+    //==============================================================================
+    bool appliesToNote (int midiNoteNumber) override                { return midiNotes [midiNoteNumber]; }
+    bool appliesToChannel (int /*midiChannel*/) override            { return true; }
+
+private:
+    //==============================================================================
+    friend class CompactSamplerVoice;
+
+    String name;
+    SampleBufferPool::Ptr pool;
+    OwnedArray<SampleData> channels;
+    WaveformPeaks peaks;
+    double sourceSampleRate = 0.0;
+    BigInteger midiNotes;
+    int length = 0;
+    int loopStart = 0, loopEnd = 0;
+    int midiRootNote;
+    VoiceEnvelopeBank::Parameters envelope;
+
+    //==============================================================================
+    JUCE_LEAK_DETECTOR (CompactSamplerSound)
+};
+
+//==============================================================================
+/** Plays a CompactSamplerSound, decoding the samples it needs for each run
+    of output into a small buffer on the stack and mixing them in with one of
+    the VoiceRenderKernels.
+
+    The voice's envelope is one slot of a VoiceEnvelopeBank shared by all the
+    voices of a CompactSynthesiser, which processes the bank before asking the
+    voices to render.
+*/
+class CompactSamplerVoice    : public SynthesiserVoice
+{
+public:
+    //==============================================================================
+    CompactSamplerVoice (VoiceEnvelopeBank& envelopeBank, int indexInEnvelopeBank)
+        : envelopes (envelopeBank),
+          envelopeIndex (indexInEnvelopeBank)
+    {
+    }
+
+    //==============================================================================
+    bool canPlaySound (SynthesiserSound* sound) override
+    {
+        return dynamic_cast<const CompactSamplerSound*> (sound) != nullptr;
+    }
+
+    void startNote (int midiNoteNumber, float velocity, SynthesiserSound* s, int /*currentPitchWheelPosition*/) override
+    {
+        if (const CompactSamplerSound* const sound = dynamic_cast<const CompactSamplerSound*> (s))
+        {
+            pitchRatio = std::pow (2.0, (midiNoteNumber - sound->midiRootNote) / 12.0)
+                            * sound->sourceSampleRate / getSampleRate();
+
+            sourceSamplePosition = 0.0;
+            lgain = velocity;
+            rgain = velocity;
+
+            envelopes.noteOn (envelopeIndex, sound->envelope, getSampleRate());
+        }
+        else
+        {
+            jassertfalse; // this object can only play CompactSamplerSounds!
+        }
+    }
+
+    void stopNote (float /*velocity*/, bool allowTailOff) override
+    {
+        if (allowTailOff)
+        {
+            envelopes.noteOff (envelopeIndex);
+        }
+        else
+        {
+            envelopes.reset (envelopeIndex);
+            clearCurrentNote();
+        }
+    }
+
+    /** The read position in the sound's sample data. */
+    double getSourceSamplePosition() const noexcept                 { return sourceSamplePosition; }
+
+    void pitchWheelMoved (int /*newValue*/) override                {}
+    void controllerMoved (int /*controllerNumber*/, int /*newValue*/) override {}
+
+    //==============================================================================
+    void renderNextBlock (AudioBuffer<float>& outputBuffer, int startSample, int numSamples) override
+    {
+        if (const CompactSamplerSound* const playingSound = static_cast<CompactSamplerSound*> (getCurrentlyPlayingSound().get()))
+        {
+            if (playingSound->hasSustainLoop())
+                renderBlock<loopingPlayback> (*playingSound, outputBuffer, startSample, numSamples);
+            else
+                renderBlock<oneShotPlayback> (*playingSound, outputBuffer, startSample, numSamples);
+        }
+    }
+
+private:
+    //==============================================================================
+    enum LoopMode
+    {
+        oneShotPlayback,
+        loopingPlayback
+    };
+
+    /** Splits the block into runs that end wherever the scratch buffer fills up
+        or the sample loops or ends, and renders each run with the kernel
+        specialised for it. The envelope bank has already worked out this
+        block's gains, and how much of it the note lasts for.
+    */
+    template <LoopMode loopMode>
+    void renderBlock (const CompactSamplerSound& sound, AudioBuffer<float>& outputBuffer, int startSample, int numSamples)
+    {
+        float scratch[2 * kScratchSize];
+
+        const int numSourceChannels = sound.getNumChannels();
+        const int numOutputChannels = jmin (2, outputBuffer.getNumChannels());
+
+        // a whole-number position that moves one sample at a time stays whole, so needs no interpolation
+        const VoiceRenderKernels::Interpolation interpolation
+            = (pitchRatio == 1.0 && sourceSamplePosition == std::floor (sourceSamplePosition)) ? VoiceRenderKernels::noInterpolation
+                                                                                                : VoiceRenderKernels::linearInterpolation;
+
+        const int maxRunLength = jmax (1, static_cast<int> ((kScratchSize - 2) / pitchRatio));
+
+        VoiceRenderKernels::Params params;
+        params.outL = outputBuffer.getWritePointer (0, startSample);
+        params.outR = numOutputChannels > 1 ? outputBuffer.getWritePointer (1, startSample) : nullptr;
+        params.pitchRatio = pitchRatio;
+        params.gainL = lgain;
+        params.gainR = rgain;
+        params.level = envelopes.getLevel (envelopeIndex);
+        params.levels = envelopes.getGains (envelopeIndex);
+
+        const VoiceRenderKernels::EnvelopeStage envelope = envelopes.usesGains (envelopeIndex) ? VoiceRenderKernels::envelopeGains
+                                                                                               : VoiceRenderKernels::constantLevel;
+
+        // the note ends early if its release finishes part-way through the block
+        const bool envelopeEnds = (envelopes.getNumActiveSamples (envelopeIndex) < numSamples);
+        numSamples = envelopes.getNumActiveSamples (envelopeIndex);
+
+        while (numSamples > 0)
+        {
+            // asks for one more than is left, so that a sample end beyond this block isn't mistaken for one within it
+            const int numUntilSampleEnd = (loopMode == loopingPlayback) ? getNumSamplesUntilLoopEnd (sound, numSamples + 1)
+                                                                        : getNumSamplesUntilSampleEnd (sound, numSamples + 1);
+
+            const int numThisRun = jmin (numSamples, maxRunLength, numUntilSampleEnd);
+
+            if (numThisRun <= 0)
+            {
+                stopNote (0.0f, false);
+                return;
+            }
+
+            const int firstSourceSample = static_cast<int> (sourceSamplePosition);
+            const int numSourceSamples = jmin (kScratchSize, static_cast<int> (sourceSamplePosition - firstSourceSample
+                                                                                + numThisRun * pitchRatio) + 2);
+
+            params.inL = sound.getChannel (0).getSamples (firstSourceSample, numSourceSamples, scratch);
+            params.inR = numSourceChannels > 1 ? sound.getChannel (1).getSamples (firstSourceSample, numSourceSamples, scratch + kScratchSize)
+                                               : nullptr;
+            params.position = sourceSamplePosition - firstSourceSample;
+
+            VoiceRenderKernels::getKernel (numSourceChannels, numOutputChannels, interpolation, envelope) (params, numThisRun);
+
+            params.outL += numThisRun;
+            params.levels += numThisRun;
+
+            if (params.outR != nullptr)
+                params.outR += numThisRun;
+
+            numSamples -= numThisRun;
+            sourceSamplePosition += numThisRun * pitchRatio;
+
+            if (loopMode == loopingPlayback)
+            {
+                while (sourceSamplePosition >= sound.loopEnd)
+                    sourceSamplePosition -= (sound.loopEnd - sound.loopStart);
+            }
+            else if (numThisRun == numUntilSampleEnd)
+            {
+                stopNote (0.0f, false);
+                return;
+            }
+        }
+
+        if (envelopeEnds)
+            stopNote (0.0f, false);
+    }
+
+    //==============================================================================
+    // These return how many samples can be rendered before something changes,
+    // limited to upTo so that large values can't overflow. A result of upTo
+    // means the change is at least that far away, not that it happens there.
+
+    int getNumSamplesUntilLoopEnd (const CompactSamplerSound& sound, int upTo) const noexcept
+    {
+        const double numSamples = (sound.loopEnd - sourceSamplePosition) / pitchRatio;
+
+        return static_cast<int> (jmin (static_cast<double> (upTo), jmax (1.0, std::ceil (numSamples))));
+    }
+
+    /** Notes stop on the first sample after the read position passes the end of the data. */
+    int getNumSamplesUntilSampleEnd (const CompactSamplerSound& sound, int upTo) const noexcept
+    {
+        const double numSamples = std::floor ((sound.length - sourceSamplePosition) / pitchRatio) + 1.0;
+
+        return static_cast<int> (jmin (static_cast<double> (upTo), numSamples));
+    }
+
+    //==============================================================================
+    static constexpr int kScratchSize = 512;
+
+    VoiceEnvelopeBank& envelopes;
+    const int envelopeIndex;
+
+    double pitchRatio = 0.0;
+    double sourceSamplePosition = 0.0;
+    float lgain = 0.0f, rgain = 0.0f;
+
+    //==============================================================================
+    JUCE_LEAK_DETECTOR (CompactSamplerVoice)
+};
+
+//==============================================================================
+/** A Synthesiser of CompactSamplerVoices that computes all of their envelopes
+    together, a block at a time, before the voices render.
+
+    After each render it publishes where every voice is reading in its sound,
+    so that the UI can draw playheads without locking the audio thread.
+*/
+class CompactSynthesiser   : public Synthesiser
+{
+public:
+    //==============================================================================
+    explicit CompactSynthesiser (int numVoices)
+    {
+        envelopes.setNumVoices (numVoices, kEnvelopeBlockSize);
+
+        playheads.ensureStorageAllocated (numVoices);
+
+        for (int i = 0; i < numVoices; ++i)
+        {
+            addVoice (new CompactSamplerVoice (envelopes, i));
+            playheads.add (Atomic<int> (-1));
+        }
+    }
+
+    //==============================================================================
+    /** Copies the sample positions of the active voices, as of the last block
+        rendered, into dest. This can be called from any thread, and returns
+        how many positions were written.
+    */
+    int getPlayheadPositions (int* dest, int maxPositions) const noexcept
+    {
+        int numPositions = 0;
+
+        for (int i = 0; i < playheads.size() && numPositions < maxPositions; ++i)
+        {
+            const int position = playheads.getReference (i).get();
+
+            if (position >= 0)
+                dest[numPositions++] = position;
+        }
+
+        return numPositions;
+    }
+
+protected:
+    //==============================================================================
+    void renderVoices (AudioBuffer<float>& outputAudio, int startSample, int numSamples) override
+    {
+        while (numSamples > 0)
+        {
+            const int numThisBlock = jmin (numSamples, kEnvelopeBlockSize);
+
+            envelopes.process (numThisBlock);
+
+            for (int i = voices.size(); --i >= 0;)
+                voices.getUnchecked (i)->renderNextBlock (outputAudio, startSample, numThisBlock);
+
+            startSample += numThisBlock;
+            numSamples -= numThisBlock;
+        }
+
+        for (int i = voices.size(); --i >= 0;)
+        {
+            const CompactSamplerVoice* const voice = static_cast<const CompactSamplerVoice*> (voices.getUnchecked (i));
+            playheads.getReference (i).set (voice->isVoiceActive() ? static_cast<int> (voice->getSourceSamplePosition()) : -1);
+        }
+    }
+
+private:
+    //==============================================================================
+    static constexpr int kEnvelopeBlockSize = 256;
+
+    VoiceEnvelopeBank envelopes;
+    Array<Atomic<int> > playheads;
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (CompactSynthesiser)
+};
+
+#endif // COMPACTSAMPLER_H_INCLUDED
@@ -0,0 +1,463 @@
+/*
+  ==============================================================================
+
+    Copyright (c) 2015 - ROLI Ltd.
+
+  ==============================================================================
+*/
+
+#ifndef LATENCYTUNER_H_INCLUDED
+#define LATENCYTUNER_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+//==============================================================================
+/** An audio callback that wraps the app's own callback and watches the device.
+
+    While watching for xruns it passes every block on to the wrapped callback,
+    so the synth's real load is part of the test, and counts a dropout whenever
+    a block arrives more than a buffer later than the device clock says it
+    should, or the wrapped callback takes longer than a buffer to run. Devices
+    are free to deliver blocks in bursts, so arriving early never counts.
+
+    While measuring round-trip latency it outputs a few single-sample clicks
+    instead, and times how many samples each one takes to come back on the
+    input, which needs a loopback cable or a loopback device.
+*/
+class LatencyProbe   : public AudioIODeviceCallback
+{
+public:
+    //==============================================================================
+    enum Mode
+    {
+        watchingForXRuns = 0,
+        measuringRoundTrip
+    };
+
+    static constexpr int noLatencyMeasured = -1;
+
+    //==============================================================================
+    explicit LatencyProbe (AudioIODeviceCallback& callbackToWrap)
+        : wrapped (callbackToWrap)
+    {
+    }
+
+    /** Switches mode and clears the results; the audio thread picks this up on its next block. */
+    void setMode (Mode newMode) noexcept
+    {
+        requestedMode.set (newMode);
+        resetCount.set (resetCount.get() + 1);
+    }
+
+    int getNumXRuns() const noexcept                                { return numXRuns.get(); }
+    bool isRoundTripTestFinished() const noexcept                   { return roundTripFinished.get() != 0; }
+
+    /** The median of the measured round trips in samples, or noLatencyMeasured. */
+    int getRoundTripLatency() const noexcept                        { return roundTripLatency.get(); }
+
+    //==============================================================================
+    void audioDeviceAboutToStart (AudioIODevice* device) override
+    {
+        sampleRate = device->getCurrentSampleRate();
+        lastResetCount = -1;
+
+        wrapped.audioDeviceAboutToStart (device);
+    }
+
+    void audioDeviceStopped() override
+    {
+        wrapped.audioDeviceStopped();
+    }
+
+    void audioDeviceIOCallback (const float** inputChannelData, int numInputChannels,
+                                float** outputChannelData, int numOutputChannels, int numSamples) override
+    {
+        if (lastResetCount != resetCount.get())
+        {
+            lastResetCount = resetCount.get();
+            mode = static_cast<Mode> (requestedMode.get());
+            resetState();
+        }
+
+        if (mode == watchingForXRuns)
+            watchForXRuns (inputChannelData, numInputChannels, outputChannelData, numOutputChannels, numSamples);
+        else
+            measureRoundTrip (inputChannelData, numInputChannels, outputChannelData, numOutputChannels, numSamples);
+    }
+
+private:
+    //==============================================================================
+    static constexpr double kWarmUpSeconds = 0.25;
+    static constexpr double kLatenessToleranceSeconds = 0.001;
+    static constexpr double kImpulseIntervalSeconds = 0.5;
+    static constexpr float kImpulseLevel = 0.8f;
+    static constexpr float kDetectionThreshold = 0.2f;
+    static constexpr int kNumImpulses = 3;
+
+    //==============================================================================
+    void resetState() noexcept
+    {
+        numXRuns.set (0);
+        roundTripFinished.set (0);
+        roundTripLatency.set (noLatencyMeasured);
+
+        clockStartSeconds = 0.0;
+        samplesSinceClockStart = 0;
+        warmUpSamplesLeft = static_cast<int64> (kWarmUpSeconds * sampleRate);
+
+        samplePosition = 0;
+        nextImpulsePosition = static_cast<int64> (kImpulseIntervalSeconds * sampleRate);
+        lastImpulsePosition = -1;
+        numImpulsesMeasured = 0;
+    }
+
+    void watchForXRuns (const float** inputChannelData, int numInputChannels,
+                        float** outputChannelData, int numOutputChannels, int numSamples)
+    {
+        const double now = Time::getMillisecondCounterHiRes() * 0.001;
+        const double bufferSeconds = numSamples / sampleRate;
+
+        if (warmUpSamplesLeft > 0)
+        {
+            // the first blocks after a device starts are often irregular
+            warmUpSamplesLeft -= numSamples;
+            clockStartSeconds = now;
+            samplesSinceClockStart = 0;
+        }
+        else if (now - (clockStartSeconds + samplesSinceClockStart / sampleRate) > bufferSeconds + kLatenessToleranceSeconds)
+        {
+            numXRuns.set (numXRuns.get() + 1);
+
+            clockStartSeconds = now;
+            samplesSinceClockStart = 0;
+        }
+
+        samplesSinceClockStart += numSamples;
+
+        wrapped.audioDeviceIOCallback (inputChannelData, numInputChannels, outputChannelData, numOutputChannels, numSamples);
+
+        if (warmUpSamplesLeft <= 0 && Time::getMillisecondCounterHiRes() * 0.001 - now > bufferSeconds)
+            numXRuns.set (numXRuns.get() + 1);
+    }
+
+    void measureRoundTrip (const float** inputChannelData, int numInputChannels,
+                           float** outputChannelData, int numOutputChannels, int numSamples) noexcept
+    {
+        for (int ch = 0; ch < numOutputChannels; ++ch)
+            if (outputChannelData[ch] != nullptr)
+                FloatVectorOperations::clear (outputChannelData[ch], numSamples);
+
+        if (roundTripFinished.get() != 0)
+            return;
+
+        // listen for the last click before sending the next one, so that each echo is matched to its click
+        if (lastImpulsePosition >= 0 && numInputChannels > 0 && inputChannelData[0] != nullptr)
+        {
+            for (int i = 0; i < numSamples; ++i)
+            {
+                if (std::abs (inputChannelData[0][i]) >= kDetectionThreshold)
+                {
+                    measuredLatencies[numImpulsesMeasured++] = static_cast<int> (samplePosition + i - lastImpulsePosition);
+                    lastImpulsePosition = -1;
+                    break;
+                }
+            }
+        }
+
+        if (numImpulsesMeasured == kNumImpulses)
+        {
+            std::sort (measuredLatencies, measuredLatencies + kNumImpulses);
+            roundTripLatency.set (measuredLatencies[kNumImpulses / 2]);
+            roundTripFinished.set (1);
+        }
+        else if (samplePosition + numSamples > nextImpulsePosition)
+        {
+            if (lastImpulsePosition >= 0)
+            {
+                // the previous click never came back, so there's no loopback to measure
+                roundTripFinished.set (1);
+            }
+            else
+            {
+                const int offset = static_cast<int> (nextImpulsePosition - samplePosition);
+
+                for (int ch = 0; ch < numOutputChannels; ++ch)
+                    if (outputChannelData[ch] != nullptr)
+                        outputChannelData[ch][offset] = kImpulseLevel;
+
+                lastImpulsePosition = nextImpulsePosition;
+                nextImpulsePosition += static_cast<int64> (kImpulseIntervalSeconds * sampleRate);
+            }
+        }
+
+        samplePosition += numSamples;
+    }
+
+    //==============================================================================
+    AudioIODeviceCallback& wrapped;
+
+    Atomic<int> requestedMode, resetCount;
+    Atomic<int> numXRuns, roundTripFinished, roundTripLatency;
+
+    // only touched by the audio thread, or while the device is stopped
+    Mode mode = watchingForXRuns;
+    int lastResetCount = -1;
+    double sampleRate = 44100.0;
+    double clockStartSeconds = 0.0;
+    int64 samplesSinceClockStart = 0, warmUpSamplesLeft = 0;
+    int64 samplePosition = 0, nextImpulsePosition = 0, lastImpulsePosition = -1;
+    int measuredLatencies[kNumImpulses];
+    int numImpulsesMeasured = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LatencyProbe)
+};
+
+//==============================================================================
+/** Finds the smallest buffer size the current device runs without dropouts,
+    optionally measures the round-trip latency at that size, and saves the result.
+
+    Starting from the current buffer size, it steps down through the device's
+    available sizes, running each for a few seconds with a LatencyProbe in
+    place of the app's callback. It stops at the first size that drops out and
+    settles on the last one that didn't. The search makes no sound of its own,
+    but the round-trip test plays clicks through the output, so it only runs
+    when asked for. All of this is driven by a timer on the message thread, so
+    the app stays responsive. A change message is sent when it's done.
+*/
+class LatencyTuner   : public ChangeBroadcaster,
+                       private Timer
+{
+public:
+    //==============================================================================
+    struct Result
+    {
+        double sampleRate;
+        int bufferSize;
+        int roundTripLatencySamples;    // LatencyProbe::noLatencyMeasured without a loopback
+        int reportedLatencySamples;     // what the device claims for input plus output
+    };
+
+    //==============================================================================
+    LatencyTuner (AudioDeviceManager& manager, AudioIODeviceCallback& appCallback, PropertiesFile& settingsToUse)
+        : deviceManager (manager),
+          callback (appCallback),
+          settings (settingsToUse),
+          probe (appCallback)
+    {
+        Result noResult = { 0.0, 0, LatencyProbe::noLatencyMeasured, 0 };
+        result = noResult;
+    }
+
+    ~LatencyTuner()
+    {
+        if (state != idle && state != finished)
+        {
+            stopTimer();
+            deviceManager.removeAudioCallback (&probe);
+            deviceManager.addAudioCallback (&callback);
+        }
+    }
+
+    //==============================================================================
+    /** Returns the device state saved by a previous run, or nullptr. The caller owns it. */
+    static XmlElement* createSavedDeviceState (PropertiesFile& settings)
+    {
+        return settings.getXmlValue (kDeviceStateKey);
+    }
+
+    /** True once a tuner has finished with these settings, even if it left the
+        device as it was and so had no device state to save.
+    */
+    static bool hasTuned (PropertiesFile& settings)
+    {
+        return settings.getBoolValue (kTunedKey);
+    }
+
+    /** Starts tuning. The app's callback must not already be attached to the device manager.
+        If shouldMeasureRoundTrip is true, the impulse test runs after the search.
+    */
+    void start (bool shouldMeasureRoundTrip)
+    {
+        jassert (state == idle);
+
+        measureRoundTrip = shouldMeasureRoundTrip;
+
+        AudioIODevice* const device = deviceManager.getCurrentAudioDevice();
+
+        if (device == nullptr)
+        {
+            state = finished;
+            sendChangeMessage();
+            return;
+        }
+
+        // steps of less than a quarter take a long time to test and gain very little
+        candidateSizes.clear();
+        candidateSizes.add (device->getCurrentBufferSizeSamples());
+
+        Array<int> available (device->getAvailableBufferSizes());
+        DefaultElementComparator<int> comparator;
+        available.sort (comparator);
+
+        for (int i = available.size(); --i >= 0;)
+            if (available.getUnchecked (i) * 4 <= candidateSizes.getLast() * 3)
+                candidateSizes.add (available.getUnchecked (i));
+
+        Logger::writeToLog ("Latency tuner: testing " + String (candidateSizes.size()) + " buffer sizes on " + device->getName());
+
+        deviceManager.addAudioCallback (&probe);
+        stableBufferSize = candidateSizes.getFirst();
+        candidateIndex = 0;
+
+        testBufferSize (candidateSizes.getFirst());
+        startTimer (kPollIntervalMs);
+    }
+
+    bool isFinished() const noexcept                                { return state == finished; }
+    const Result& getResult() const noexcept                        { return result; }
+
+private:
+    //==============================================================================
+    enum State
+    {
+        idle,
+        searchingBufferSizes,
+        measuringLatency,
+        finished
+    };
+
+    static constexpr double kSecondsPerBufferSize = 2.0;
+    static constexpr double kLatencyTestTimeoutSeconds = 3.0;
+    static constexpr int kPollIntervalMs = 100;
+    static constexpr const char* kDeviceStateKey = "audioDeviceState";
+    static constexpr const char* kRoundTripLatencyKey = "roundTripLatencySamples";
+    static constexpr const char* kTunedKey = "latencyTuned";
+
+    //==============================================================================
+    void timerCallback() override
+    {
+        const double elapsed = (Time::getMillisecondCounterHiRes() - stepStartMs) * 0.001;
+
+        if (state == searchingBufferSizes)
+        {
+            if (elapsed < kSecondsPerBufferSize)
+                return;
+
+            const int numXRuns = probe.getNumXRuns();
+            Logger::writeToLog ("  " + String (candidateSizes[candidateIndex]) + " samples: " + String (numXRuns) + " xruns");
+
+            if (numXRuns == 0)
+            {
+                stableBufferSize = candidateSizes[candidateIndex];
+
+                if (++candidateIndex < candidateSizes.size())
+                {
+                    testBufferSize (candidateSizes[candidateIndex]);
+                    return;
+                }
+            }
+
+            if (getCurrentBufferSize() != stableBufferSize)
+                setBufferSize (stableBufferSize);
+
+            if (! measureRoundTrip)
+            {
+                finish();
+                return;
+            }
+
+            state = measuringLatency;
+            probe.setMode (LatencyProbe::measuringRoundTrip);
+            stepStartMs = Time::getMillisecondCounterHiRes();
+        }
+        else if (state == measuringLatency)
+        {
+            if (! probe.isRoundTripTestFinished() && elapsed < kLatencyTestTimeoutSeconds)
+                return;
+
+            finish();
+        }
+    }
+
+    void testBufferSize (int bufferSize)
+    {
+        state = searchingBufferSizes;
+        setBufferSize (bufferSize);
+        probe.setMode (LatencyProbe::watchingForXRuns);
+        stepStartMs = Time::getMillisecondCounterHiRes();
+    }
+
+    void setBufferSize (int bufferSize)
+    {
+        AudioDeviceManager::AudioDeviceSetup setup;
+        deviceManager.getAudioDeviceSetup (setup);
+        setup.bufferSize = bufferSize;
+
+        const String error (deviceManager.setAudioDeviceSetup (setup, true));
+
+        if (error.isNotEmpty())
+            Logger::writeToLog ("  couldn't use " + String (bufferSize) + " samples: " + error);
+    }
+
+    int getCurrentBufferSize() const
+    {
+        AudioIODevice* const device = deviceManager.getCurrentAudioDevice();
+        return device != nullptr ? device->getCurrentBufferSizeSamples() : 0;
+    }
+
+    void finish()
+    {
+        stopTimer();
+        state = finished;
+
+        deviceManager.removeAudioCallback (&probe);
+        deviceManager.addAudioCallback (&callback);
+
+        if (AudioIODevice* const device = deviceManager.getCurrentAudioDevice())
+        {
+            result.sampleRate = device->getCurrentSampleRate();
+            result.bufferSize = device->getCurrentBufferSizeSamples();
+            result.reportedLatencySamples = device->getInputLatencyInSamples() + device->getOutputLatencyInSamples();
+        }
+
+        result.roundTripLatencySamples = probe.getRoundTripLatency();
+
+        Logger::writeToLog ("Latency tuner: " + String (result.bufferSize) + " samples at " + String (result.sampleRate) + " Hz, "
+                              + (result.roundTripLatencySamples != LatencyProbe::noLatencyMeasured
+                                   ? "measured round trip " + String (result.roundTripLatencySamples) + " samples"
+                                   : String ("no loopback found"))
+                              + ", device reports " + String (result.reportedLatencySamples));
+
+        // the manager has no state to give if the setup never changed from its default
+        ScopedPointer<XmlElement> deviceState (deviceManager.createStateXml());
+
+        if (deviceState != nullptr)
+            settings.setValue (kDeviceStateKey, deviceState);
+
+        if (measureRoundTrip)
+            settings.setValue (kRoundTripLatencyKey, result.roundTripLatencySamples);
+
+        settings.setValue (kTunedKey, true);
+        settings.saveIfNeeded();
+
+        sendChangeMessage();
+    }
+
+    //==============================================================================
+    AudioDeviceManager& deviceManager;
+    AudioIODeviceCallback& callback;
+    PropertiesFile& settings;
+    LatencyProbe probe;
+
+    State state = idle;
+    bool measureRoundTrip = false;
+    Array<int> candidateSizes;
+    int candidateIndex = 0;
+    int stableBufferSize = 0;
+    double stepStartMs = 0.0;
+    Result result;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (LatencyTuner)
+};
+
+#endif // LATENCYTUNER_H_INCLUDED
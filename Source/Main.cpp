@@ -8,9 +8,15 @@
 
 #include "../JuceLibraryCode/JuceHeader.h"
 #include "MainComponent.h"
+#include "MaterialLookAndFeel.h"
+#include "Benchmarks.h"
+#include "RenderRegression.h"
+#include "LatencyTuner.h"
+#include "SimulatedAudioDevice.h"
 
 //==============================================================================
-class AndroidSynthApplication  : public  JUCEApplication
+class AndroidSynthApplication  : public  JUCEApplication,
+                                 private ChangeListener
 {
 public:
     //==============================================================================
@@ -23,20 +29,67 @@ public:
     //==============================================================================
     void initialise (const String& commandLine) override
     {
-        ignoreUnused (commandLine);
+        if (commandLine.contains ("--benchmark"))
+        {
+            SynthBenchmarks::runAll();
+            quit();
+            return;
+        }
+
+        if (commandLine.contains ("--check-renders"))
+        {
+            const int numFailures = RenderRegression::runAll (RenderRegression::parseOptions (commandLine));
+            setApplicationReturnValue (numFailures > 0 ? 1 : 0);
+            quit();
+            return;
+        }
+
+        // the simulated device gets its own settings file, so testing with it never overwrites the real device's
+        const bool useSimulatedDevice = commandLine.contains ("--simulated-audio");
 
-        String err = deviceManager.initialiseWithDefaultDevices (1, 1);
+        if (useSimulatedDevice)
+            deviceManager.addAudioDeviceType (new SimulatedLoopbackDeviceType());
+
+        settings = new PropertiesFile (getSettingsFileOptions (useSimulatedDevice));
+
+        ScopedPointer<XmlElement> savedDeviceState (LatencyTuner::createSavedDeviceState (*settings));
+        String err = deviceManager.initialise (1, 1, savedDeviceState, true);
         jassert (err.isEmpty());
 
-        deviceManager.addAudioCallback (&player);
+        processor = new AndroidSynthProcessor();
+        player.setProcessor (processor);
+
+        // the first launch only runs the silent buffer size search; the round-trip test plays
+        // clicks, so it needs --tune-latency. A device that already runs at its smallest
+        // buffer size by default has nothing to gain from the search.
+        const bool tuningRequested = commandLine.contains ("--tune-latency");
+
+        if (tuningRequested || (! LatencyTuner::hasTuned (*settings) && ! isLowLatencyAudio()))
+        {
+            quitAfterTuning = commandLine.contains ("--quit-after-tuning");
+
+            latencyTuner = new LatencyTuner (deviceManager, player, *settings);
+            latencyTuner->addChangeListener (this);
+            latencyTuner->start (tuningRequested);
+        }
+        else
+        {
+            deviceManager.addAudioCallback (&player);
+        }
+
         deviceManager.addMidiInputCallback (String(), &player);
 
+        LookAndFeel::setDefaultLookAndFeel (&lookAndFeel);
         mainWindow = new MainWindow (player, getApplicationName());
     }
 
     void shutdown() override
     {
         mainWindow = nullptr;
+        LookAndFeel::setDefaultLookAndFeel (nullptr);
+
+        // a tuner that hasn't finished puts the player back on the device when it's deleted
+        latencyTuner = nullptr;
 
         deviceManager.removeMidiInputCallback (String(), &player);
         deviceManager.removeAudioCallback (&player);
@@ -94,6 +147,28 @@ private:
     //==============================================================================
     AudioDeviceManager deviceManager;
     AudioProcessorPlayer player;
+    ScopedPointer<AndroidSynthProcessor> processor;
+    MaterialLookAndFeel lookAndFeel;
+
+    ScopedPointer<PropertiesFile> settings;
+    ScopedPointer<LatencyTuner> latencyTuner;
+    bool quitAfterTuning = false;
+
+    static PropertiesFile::Options getSettingsFileOptions (bool forSimulatedDevice)
+    {
+        PropertiesFile::Options options;
+        options.applicationName = ProjectInfo::projectName;
+        options.filenameSuffix = forSimulatedDevice ? "simulated.settings" : "settings";
+        options.osxLibrarySubFolder = "Application Support";
+
+        return options;
+    }
+
+    void changeListenerCallback (ChangeBroadcaster*) override
+    {
+        if (quitAfterTuning && latencyTuner != nullptr && latencyTuner->isFinished())
+            quit();
+    }
 
     bool isLowLatencyAudio()
     {
@@ -10,6 +10,7 @@
 #define MAINCOMPONENT_H_INCLUDED
 
 #include "../JuceLibraryCode/JuceHeader.h"
+#include "WaveformComponent.h"
 
 //==============================================================================
 class MainContentComponent   : public Component,
@@ -23,11 +24,13 @@ public:
         :   player (processorPlayer),
             keyboard (keyboardState, MidiKeyboardComponent::horizontalKeyboard),
             recordButton ("Record"),
-            roomSizeSlider (Slider::LinearHorizontal, Slider::NoTextBox)
+            roomSizeSlider (Slider::LinearHorizontal, Slider::NoTextBox),
+            waveform (processorPlayer)
     {
         keyboardState.addListener (&processorPlayer.getMidiMessageCollector());
 
-        roomSizeSlider.setValue (getParameterValue ("roomSize"), NotificationType::dontSendNotification);
+        lastRoomSize = getParameterValue ("roomSize");
+        roomSizeSlider.setValue (lastRoomSize, NotificationType::dontSendNotification);
 
         keyboard.setLowestVisibleKey (0x30);
         keyboard.setKeyWidth (600/0x10);
@@ -40,6 +43,8 @@ public:
         roomSizeSlider.setRange (0.0, 1.0);
         addAndMakeVisible (roomSizeSlider);
 
+        addAndMakeVisible (waveform);
+
         Path proAudioPath;
         proAudioPath.loadPathFromData (BinaryData::proaudio_path, BinaryData::proaudio_pathSize);
         proAudioIcon.setPath (proAudioPath);
@@ -48,6 +53,12 @@ public:
         Colour proAudioIconColour = findColour (TextButton::buttonColourId);
         proAudioIcon.setFill (FillType (proAudioIconColour));
 
+        // the icon never changes, so it's rendered once and then just blitted
+        proAudioIcon.setBufferedToImage (true);
+
+        // this component fills its whole area, so nothing behind it needs repainting when a control changes
+        setOpaque (true);
+
         setSize (600, 400);
         startTimer (100);
     }
@@ -77,6 +88,7 @@ public:
 
         recordButton.setBounds (r.removeFromTop (guiElementAreaHeight).withSizeKeepingCentre (r.getWidth(), buttonHeight));
         roomSizeSlider.setBounds (r.removeFromTop (guiElementAreaHeight).withSizeKeepingCentre (r.getWidth(), buttonHeight));
+        waveform.setBounds (r);
     }
 
     //==========================================================================
@@ -85,23 +97,39 @@ public:
         if (button == &recordButton)
         {
             recordButton.setEnabled (false);
+            wasRecording = true;
             setParameterValue ("isRecording", 1.0f);
         }
     }
 
     void sliderValueChanged (Slider*) override
     {
-        setParameterValue ("roomSize", static_cast<float> (roomSizeSlider.getValue()));
+        lastRoomSize = static_cast<float> (roomSizeSlider.getValue());
+        setParameterValue ("roomSize", lastRoomSize);
     }
 
 private:
     //==========================================================================
+    /** Polls the parameters, but only touches a control (and so only repaints
+        its area) when its value has actually changed.
+    */
     void timerCallback() override
     {
-        bool isRecordingNow = (getParameterValue ("isRecording") >= 0.5f);
+        const bool isRecordingNow = (getParameterValue ("isRecording") >= 0.5f);
+
+        if (isRecordingNow != wasRecording)
+        {
+            wasRecording = isRecordingNow;
+            recordButton.setEnabled (! isRecordingNow);
+        }
+
+        const float roomSize = getParameterValue ("roomSize");
 
-        recordButton.setEnabled (! isRecordingNow);
-        roomSizeSlider.setValue (getParameterValue ("roomSize"), NotificationType::dontSendNotification);
+        if (roomSize != lastRoomSize)
+        {
+            lastRoomSize = roomSize;
+            roomSizeSlider.setValue (roomSize, NotificationType::dontSendNotification);
+        }
     }
 
     //==========================================================================
@@ -148,6 +176,10 @@ private:
     TextButton recordButton;
     Slider roomSizeSlider;
     DrawablePath proAudioIcon;
+    WaveformComponent waveform;
+
+    bool wasRecording = false;
+    float lastRoomSize = 0.0f;
 
     //==========================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MainContentComponent)
@@ -6,9 +6,18 @@
   ==============================================================================
 */
 
+#ifndef MATERIALLOOKANDFEEL_H_INCLUDED
+#define MATERIALLOOKANDFEEL_H_INCLUDED
+
 #include "../JuceLibraryCode/JuceHeader.h"
 
 //==============================================================================
+/** The app's flat, material-style look.
+
+    Button backgrounds and the slider's knob and halo never change for a given
+    size and state, so they're rendered once into images at the display's
+    physical pixel scale and blitted after that.
+*/
 class MaterialLookAndFeel : public LookAndFeel_V3
 {
 public:
@@ -29,20 +38,9 @@ public:
     {
         ignoreUnused (isMouseOverButton);
 
-        const int width = button.getWidth();
-        const int height = button.getHeight();
-
-        Rectangle<float> buttonRect (0, 0, width, height);
-        buttonRect.reduce (haloRadius, 0.0f);
+        const int state = isButtonDown ? buttonDown : (button.isEnabled() ? buttonNormal : buttonDisabled);
 
-        if (isButtonDown)
-            g.setColour (brightButtonColour.withAlpha (0.7f));
-        else if (! button.isEnabled())
-            g.setColour (disabledButtonColour);
-        else
-            g.setColour (brightButtonColour);
-
-        g.fillRoundedRectangle (buttonRect, 5.0f);
+        drawCachedImage (g, buttonBackgroundImage, state, 0, 0, button.getWidth(), button.getHeight());
     }
 
     //==========================================================================
@@ -90,8 +88,7 @@ public:
                                          .withWidth (haloRadius*2)
                                          .withSizeKeepingCentre(haloRadius*2, haloRadius*2);
 
-            g.setColour (sliderActivePart.withAlpha (0.5f));
-            g.fillEllipse (haloBounds.toFloat());
+            drawCachedImage (g, sliderHaloImage, 0, haloBounds.getX(), haloBounds.getY(), haloBounds.getWidth(), haloBounds.getHeight());
         }
 
         const int knobRadius = slider.isMouseOverOrDragging() ? knobActiveRadius : knobInActiveRadius;
@@ -99,8 +96,7 @@ public:
                                      .withWidth (knobRadius*2)
                                      .withSizeKeepingCentre(knobRadius*2, knobRadius*2);
 
-        g.setColour (sliderActivePart);
-        g.fillEllipse (knobBounds.toFloat());
+        drawCachedImage (g, sliderKnobImage, 0, knobBounds.getX(), knobBounds.getY(), knobBounds.getWidth(), knobBounds.getHeight());
     }
 
     //==========================================================================
@@ -114,6 +110,18 @@ public:
         return LookAndFeel_V3::getLabelFont (label).withHeight (labelFontSize);
     }
 
+    //==========================================================================
+    /** Turns the image cache on or off. With it off, everything is drawn
+        directly, which is only useful for measuring what the cache saves.
+    */
+    void setImageCachingEnabled (bool shouldCacheImages)
+    {
+        isImageCachingEnabled = shouldCacheImages;
+        cachedImages.clear();
+    }
+
+    bool isImageCachingOn() const noexcept                      { return isImageCachingEnabled; }
+
     //==========================================================================
     const int labelFontSize = 12;
     const int buttonFontSize = 15;
@@ -130,4 +138,110 @@ public:
     const Colour disabledButtonColour = Colour (0xffe4e4e4);
     const Colour sliderInactivePart = Colour (0xff545d62);
     const Colour sliderActivePart = Colour (0xff80cbc4);
+
+private:
+    //==========================================================================
+    enum CachedImageType
+    {
+        buttonBackgroundImage,
+        sliderKnobImage,
+        sliderHaloImage
+    };
+
+    enum ButtonState
+    {
+        buttonNormal,
+        buttonDown,
+        buttonDisabled
+    };
+
+    struct CachedImage
+    {
+        CachedImageType type;
+        int state, width, height;
+        float scale;
+        Image image;
+    };
+
+    //==========================================================================
+    void drawCachedImage (Graphics& g, CachedImageType type, int state, int x, int y, int width, int height)
+    {
+        if (width <= 0 || height <= 0)
+            return;
+
+        if (! isImageCachingEnabled)
+        {
+            drawImageContent (g, type, state, Rectangle<float> ((float) x, (float) y, (float) width, (float) height));
+            return;
+        }
+
+        const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+
+        g.drawImageTransformed (getCachedImage (type, state, width, height, scale),
+                                AffineTransform::scale (1.0f / scale).translated ((float) x, (float) y));
+    }
+
+    Image getCachedImage (CachedImageType type, int state, int width, int height, float scale)
+    {
+        for (int i = 0; i < cachedImages.size(); ++i)
+        {
+            const CachedImage& cached = cachedImages.getReference (i);
+
+            if (cached.type == type && cached.state == state && cached.width == width
+                 && cached.height == height && cached.scale == scale)
+                return cached.image;
+        }
+
+        Image image (Image::ARGB, jmax (1, roundToInt (width * scale)), jmax (1, roundToInt (height * scale)), true);
+
+        {
+            Graphics g (image);
+            g.addTransform (AffineTransform::scale (scale));
+            drawImageContent (g, type, state, Rectangle<float> ((float) width, (float) height));
+        }
+
+        // sizes only change on layout, so a small cache is plenty; drop the oldest entry when it's full
+        if (cachedImages.size() >= maxNumCachedImages)
+            cachedImages.remove (0);
+
+        CachedImage cached = { type, state, width, height, scale, image };
+        cachedImages.add (cached);
+
+        return image;
+    }
+
+    void drawImageContent (Graphics& g, CachedImageType type, int state, Rectangle<float> area)
+    {
+        switch (type)
+        {
+            case buttonBackgroundImage:
+                if (state == buttonDown)
+                    g.setColour (brightButtonColour.withAlpha (0.7f));
+                else if (state == buttonDisabled)
+                    g.setColour (disabledButtonColour);
+                else
+                    g.setColour (brightButtonColour);
+
+                g.fillRoundedRectangle (area.reduced ((float) haloRadius, 0.0f), 5.0f);
+                break;
+
+            case sliderHaloImage:
+                g.setColour (sliderActivePart.withAlpha (0.5f));
+                g.fillEllipse (area);
+                break;
+
+            case sliderKnobImage:
+                g.setColour (sliderActivePart);
+                g.fillEllipse (area);
+                break;
+        }
+    }
+
+    //==========================================================================
+    const int maxNumCachedImages = 16;
+
+    bool isImageCachingEnabled = true;
+    Array<CachedImage> cachedImages;
 };
+
+#endif   // MATERIALLOOKANDFEEL_H_INCLUDED
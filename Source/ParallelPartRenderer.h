@@ -0,0 +1,131 @@
+/*
+  ==============================================================================
+
+    Copyright (c) 2015 - ROLI Ltd.
+
+  ==============================================================================
+*/
+
+#ifndef PARALLELPARTRENDERER_H_INCLUDED
+#define PARALLELPARTRENDERER_H_INCLUDED
+
+#include "SynthPart.h"
+
+//==============================================================================
+/** Renders a set of SynthParts concurrently.
+
+    The worker threads are started once and then sleep on an event between
+    blocks. For each block the audio thread wakes as many workers as it needs,
+    joins in itself, and all threads pull parts from a shared counter until
+    none are left. Each part writes only to its own buffer, so the summed
+    result doesn't depend on which thread rendered which part.
+*/
+class ParallelPartRenderer
+{
+public:
+    //==============================================================================
+    explicit ParallelPartRenderer (int numWorkerThreads)
+    {
+        for (int i = 0; i < numWorkerThreads; ++i)
+        {
+            Worker* worker = workers.add (new Worker (*this));
+            worker->startThread (kWorkerThreadPriority);
+        }
+    }
+
+    ~ParallelPartRenderer()
+    {
+        for (int i = 0; i < workers.size(); ++i)
+        {
+            Worker& worker = *workers.getUnchecked (i);
+
+            worker.signalThreadShouldExit();
+            worker.startRendering.signal();
+            worker.stopThread (1000);
+        }
+    }
+
+    //==============================================================================
+    int getNumWorkerThreads() const noexcept                         { return workers.size(); }
+
+    /** Renders all the given parts and returns once every one of them is done. */
+    void render (SynthPart* const* partsToRender, int numParts, int numSamples)
+    {
+        const int numWorkersToWake = jmin (workers.size(), numParts - 1);
+
+        if (numWorkersToWake <= 0)
+        {
+            for (int i = 0; i < numParts; ++i)
+                partsToRender[i]->render (numSamples);
+
+            return;
+        }
+
+        parts = partsToRender;
+        numPartsToRender = numParts;
+        blockSize = numSamples;
+
+        nextPartIndex.set (0);
+        numWorkersBusy.set (numWorkersToWake);
+
+        for (int i = 0; i < numWorkersToWake; ++i)
+            workers.getUnchecked (i)->startRendering.signal();
+
+        renderPendingParts();
+        allWorkersDone.wait();
+    }
+
+private:
+    //==============================================================================
+    struct Worker  : public Thread
+    {
+        Worker (ParallelPartRenderer& r)  : Thread ("Part Renderer"), owner (r) {}
+
+        void run() override
+        {
+            for (;;)
+            {
+                startRendering.wait();
+
+                if (threadShouldExit())
+                    return;
+
+                owner.renderPendingParts();
+
+                if (--owner.numWorkersBusy == 0)
+                    owner.allWorkersDone.signal();
+            }
+        }
+
+        ParallelPartRenderer& owner;
+        WaitableEvent startRendering;
+
+        JUCE_DECLARE_NON_COPYABLE (Worker)
+    };
+
+    //==============================================================================
+    void renderPendingParts()
+    {
+        for (int i = (++nextPartIndex) - 1; i < numPartsToRender; i = (++nextPartIndex) - 1)
+            parts[i]->render (blockSize);
+    }
+
+    //==============================================================================
+    static constexpr int kWorkerThreadPriority = 9;
+
+    //==============================================================================
+    OwnedArray<Worker> workers;
+    WaitableEvent allWorkersDone;
+
+    SynthPart* const* parts = nullptr;
+    int numPartsToRender = 0;
+    int blockSize = 0;
+
+    Atomic<int> nextPartIndex;
+    Atomic<int> numWorkersBusy;
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ParallelPartRenderer)
+};
+
+#endif // PARALLELPARTRENDERER_H_INCLUDED
@@ -0,0 +1,173 @@
+/*
+  ==============================================================================
+
+    Copyright (c) 2015 - ROLI Ltd.
+
+  ==============================================================================
+*/
+
+#ifndef RECORDINGANALYSER_H_INCLUDED
+#define RECORDINGANALYSER_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+#if JUCE_INTEL
+ #include <xmmintrin.h>
+#elif defined (__ARM_NEON__) || defined (__ARM_NEON)
+ #include <arm_neon.h>
+#endif
+
+//==============================================================================
+/** Finds the useful part of a recording.
+
+    The recording is scanned in short windows. The onset is the first window
+    whose peak reaches the onset threshold, and the end is the last window whose
+    RMS level is still above the end threshold. Everything outside that range,
+    apart from a little pre-roll and tail, is silence that would only cost note
+    latency and memory.
+*/
+class RecordingAnalyser
+{
+public:
+    //==============================================================================
+    struct Settings
+    {
+        bool trimSilence = true;
+        float onsetThresholdDb = -40.0f;
+        float endThresholdDb = -50.0f;
+        double windowSeconds = 0.005;
+        double preRollSeconds = 0.005;
+        double tailSeconds = 0.02;
+        double fadeSeconds = 0.002;
+
+        bool normalise = false;
+        float normaliseTargetDb = -1.0f;
+    };
+
+    struct Result
+    {
+        int startSample;
+        int numSamples;
+        float peakLevel;
+        bool isSilent;
+    };
+
+    //==============================================================================
+    static Result analyse (const float* samples, int numSamples, double sampleRate, const Settings& settings)
+    {
+        const int windowSize = jmax (1, roundToInt (settings.windowSeconds * sampleRate));
+        const float onsetThreshold = Decibels::decibelsToGain (settings.onsetThresholdDb);
+        const float endThresholdSquared = square (Decibels::decibelsToGain (settings.endThresholdDb));
+
+        Result result = { 0, numSamples, getPeakLevel (samples, numSamples), false };
+
+        if (! settings.trimSilence)
+            return result;
+
+        int onset = -1;
+
+        for (int start = 0; start < numSamples && onset < 0; start += windowSize)
+            if (getPeakLevel (samples + start, jmin (windowSize, numSamples - start)) >= onsetThreshold)
+                onset = start;
+
+        if (onset < 0)
+        {
+            result.numSamples = 0;
+            result.isSilent = true;
+            return result;
+        }
+
+        int end = onset + windowSize;
+
+        for (int start = ((numSamples - 1) / windowSize) * windowSize; start > onset; start -= windowSize)
+        {
+            const int num = jmin (windowSize, numSamples - start);
+
+            if (getSumOfSquares (samples + start, num) >= endThresholdSquared * num)
+            {
+                end = start + num;
+                break;
+            }
+        }
+
+        result.startSample = jmax (0, onset - roundToInt (settings.preRollSeconds * sampleRate));
+        result.numSamples = jmin (numSamples, end + roundToInt (settings.tailSeconds * sampleRate)) - result.startSample;
+        result.peakLevel = getPeakLevel (samples + result.startSample, result.numSamples);
+
+        return result;
+    }
+
+    /** Fades the ends of the trimmed range and applies any normalisation, in place. */
+    static void process (AudioBuffer<float>& buffer, const Result& result, double sampleRate, const Settings& settings)
+    {
+        if (result.isSilent || result.numSamples <= 0)
+            return;
+
+        if (settings.trimSilence)
+        {
+            const int fadeLength = jmin (result.numSamples / 2, roundToInt (settings.fadeSeconds * sampleRate));
+
+            if (result.startSample > 0)
+                buffer.applyGainRamp (result.startSample, fadeLength, 0.0f, 1.0f);
+
+            if (result.startSample + result.numSamples < buffer.getNumSamples())
+                buffer.applyGainRamp (result.startSample + result.numSamples - fadeLength, fadeLength, 1.0f, 0.0f);
+        }
+
+        if (settings.normalise && result.peakLevel > 0.0f)
+            buffer.applyGain (result.startSample, result.numSamples,
+                              Decibels::decibelsToGain (settings.normaliseTargetDb) / result.peakLevel);
+    }
+
+    //==============================================================================
+    static float getPeakLevel (const float* samples, int numSamples) noexcept
+    {
+        if (numSamples <= 0)
+            return 0.0f;
+
+        const Range<float> range (FloatVectorOperations::findMinAndMax (samples, numSamples));
+        return jmax (range.getEnd(), -range.getStart());
+    }
+
+    static float getSumOfSquares (const float* samples, int numSamples) noexcept
+    {
+        float sum = 0.0f;
+        int i = 0;
+
+       #if JUCE_INTEL
+        __m128 acc = _mm_setzero_ps();
+
+        for (; i + 4 <= numSamples; i += 4)
+        {
+            const __m128 s = _mm_loadu_ps (samples + i);
+            acc = _mm_add_ps (acc, _mm_mul_ps (s, s));
+        }
+
+        float lanes[4];
+        _mm_storeu_ps (lanes, acc);
+        sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+       #elif defined (__ARM_NEON__) || defined (__ARM_NEON)
+        float32x4_t acc = vdupq_n_f32 (0.0f);
+
+        for (; i + 4 <= numSamples; i += 4)
+        {
+            const float32x4_t s = vld1q_f32 (samples + i);
+            acc = vmlaq_f32 (acc, s, s);
+        }
+
+        float lanes[4];
+        vst1q_f32 (lanes, acc);
+        sum = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+       #endif
+
+        for (; i < numSamples; ++i)
+            sum += samples[i] * samples[i];
+
+        return sum;
+    }
+
+private:
+    JUCE_DECLARE_NON_COPYABLE (RecordingAnalyser)
+};
+
+#endif // RECORDINGANALYSER_H_INCLUDED
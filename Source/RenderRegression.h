@@ -0,0 +1,667 @@
+/*
+  ==============================================================================
+
+    Copyright (c) 2015 - ROLI Ltd.
+
+  ==============================================================================
+*/
+
+#ifndef RENDERREGRESSION_H_INCLUDED
+#define RENDERREGRESSION_H_INCLUDED
+
+#include "AndroidSynthProcessor.h"
+
+//==============================================================================
+/** Headless checks of the synth's audio output, run with --check-renders.
+
+    A set of fixed MIDI scripts is rendered offline through AndroidSynthProcessor.
+    Each render must be bit-exact across repeated runs and across different
+    numbers of render threads, and must match a stored reference render to
+    within a tolerance. Any difference is reported with its peak error and
+    the first sample where the output diverges, and the offending render is
+    written next to the reference so the two can be compared in an editor.
+
+    Every render is also compared with the same script played the way the
+    synth worked before CompactSampler, through JUCE's own SamplerVoice. The
+    two store and mix samples differently, so they're compared by level over
+    short windows rather than sample by sample; that still catches notes that
+    are cut short, missing or in the wrong place. References are only updated
+    from renders that pass this check, so a broken build can't become one.
+
+    Before any rendering, the compressed sample format is checked to decode to
+    exactly the same samples as int16 storage.
+
+    The project has no separate test target, so this class, SynthBenchmarks and
+    SimulatedLoopbackDevice are compiled into the app itself and only run when
+    asked for on the command line. That's a stopgap: they belong in a console
+    target of their own, which would keep them out of the shipping binary.
+
+    Options (all optional):
+        --reference-dir=<path>      where the reference .wav files live
+        --tolerance=<value>         the largest absolute difference from a reference that passes
+        --baseline-tolerance=<dB>   the largest difference in level from the baseline that passes
+        --update-references         writes new references instead of comparing against them
+*/
+class RenderRegression
+{
+public:
+    //==============================================================================
+    struct Options
+    {
+        File referenceDirectory { File::getCurrentWorkingDirectory().getChildFile ("RenderReferences") };
+        float tolerance = 1.0e-5f;
+        float baselineToleranceDb = 1.0f;
+        bool updateReferences = false;
+    };
+
+    static Options parseOptions (const String& commandLine)
+    {
+        Options options;
+        StringArray args;
+        args.addTokens (commandLine, true);
+
+        for (int i = 0; i < args.size(); ++i)
+        {
+            const String arg (args[i].unquoted());
+
+            if (arg.startsWith ("--reference-dir="))
+                options.referenceDirectory = File::getCurrentWorkingDirectory().getChildFile (arg.fromFirstOccurrenceOf ("=", false, false).unquoted());
+            else if (arg.startsWith ("--tolerance="))
+                options.tolerance = jmax (0.0f, arg.fromFirstOccurrenceOf ("=", false, false).getFloatValue());
+            else if (arg.startsWith ("--baseline-tolerance="))
+                options.baselineToleranceDb = jmax (0.0f, arg.fromFirstOccurrenceOf ("=", false, false).getFloatValue());
+            else if (arg == "--update-references")
+                options.updateReferences = true;
+        }
+
+        return options;
+    }
+
+    //==============================================================================
+    /** Renders every script and checks it, returning the number of checks that failed. */
+    static int runAll (const Options& options)
+    {
+        Logger::writeToLog ("Render checks (" + String (kSampleRate) + " Hz, "
+                              + String (kBlockSize) + " sample blocks, tolerance "
+                              + String (options.tolerance) + "):");
+
+        if (options.updateReferences && ! options.referenceDirectory.createDirectory().wasOk())
+        {
+            Logger::writeToLog ("  can't create " + options.referenceDirectory.getFullPathName());
+            return 1;
+        }
+
+        if (! options.updateReferences && ! options.referenceDirectory.isDirectory())
+            Logger::writeToLog ("  no reference renders in " + options.referenceDirectory.getFullPathName()
+                                  + " - every script will fail until they're generated with --update-references"
+                                  + " on a known-good build, or --reference-dir points at them");
+
+        OwnedArray<Script> scripts;
+        createScripts (scripts);
+
+        int numFailures = checkCompressedStorage() ? 0 : 1;
+
+        for (int i = 0; i < scripts.size(); ++i)
+        {
+            const Script& script = *scripts.getUnchecked (i);
+            const AudioBuffer<float> output (render (script, 0));
+
+            if (! checkDeterminism (script, output))
+                ++numFailures;
+
+            const bool matchesBaseline = checkBaseline (script, output, options);
+
+            if (! matchesBaseline)
+                ++numFailures;
+
+            if (options.updateReferences && ! matchesBaseline)
+                Logger::writeToLog ("  " + script.name + ": reference not updated, as the render doesn't match the baseline");
+            else if (! checkReference (script, output, options))
+                ++numFailures;
+        }
+
+        Logger::writeToLog (numFailures == 0 ? String ("All render checks passed")
+                                             : String (numFailures) + " render check(s) failed");
+        return numFailures;
+    }
+
+private:
+    //==============================================================================
+    static constexpr double kSampleRate = 44100.0;
+    static constexpr int kBlockSize = 512;
+    static constexpr int kNumOutputChannels = 2;
+
+    // the baseline has a synth of this many voices on every MIDI channel, like AndroidSynthProcessor's parts
+    static constexpr int kNumBaselineChannels = 16;
+    static constexpr int kNumBaselineVoices = 5;
+
+    // the number of samples in each of SampleData's compressed blocks
+    static constexpr int kCompressedBlockSize = 256;
+
+    // levels are compared over 10 ms windows, ignoring any quieter than this below the loudest
+    static constexpr int kLevelWindowSize = 441;
+    static constexpr float kLevelFloorDb = -60.0f;
+
+    //==============================================================================
+    /** Checks that compressed sample data decodes to the same bits as int16 data,
+        for reads that start and end anywhere, including across block boundaries,
+        into a final partial block and past the end of the data. The test signal
+        has a block whose deltas are all zero and one that needs 17-bit deltas.
+    */
+    static bool checkCompressedStorage()
+    {
+        const int numSamples = 5 * kCompressedBlockSize + 37;
+        HeapBlock<float> source ((size_t) numSamples);
+        Random random (0x5eed);
+
+        // every value is an exact 16-bit level, so int16 storage must give it back unchanged
+        for (int i = 0; i < numSamples; ++i)
+        {
+            int value;
+
+            if (i < kCompressedBlockSize)
+                value = 8192;                                   // constant: 0-bit deltas
+            else if (i < 2 * kCompressedBlockSize)
+                value = (i & 1) != 0 ? 32767 : -32768;          // full-scale swings: 17-bit deltas
+            else if (i < 4 * kCompressedBlockSize)
+                value = random.nextInt (65536) - 32768;
+            else
+                value = (i * 37) % 2000 - 1000;                 // small deltas, into a partial last block
+
+            source[i] = value / 32768.0f;
+        }
+
+        const int lengths[] = { 1, kCompressedBlockSize, numSamples };
+        const int readStarts[] = { 0, 1, kCompressedBlockSize - 1, kCompressedBlockSize, kCompressedBlockSize + 1,
+                                   2 * kCompressedBlockSize - 3, 1000, numSamples - 40, numSamples - 1, numSamples, numSamples + 10 };
+        const int readLengths[] = { 1, 3, kCompressedBlockSize + 7, 700, numSamples };
+
+        HeapBlock<float> int16Scratch ((size_t) numSamples), compressedScratch ((size_t) numSamples);
+
+        for (int l = 0; l < numElementsInArray (lengths); ++l)
+        {
+            const SampleData int16Data (source, lengths[l], SampleData::int16Samples);
+            const SampleData compressedData (source, lengths[l], SampleData::compressedSamples);
+
+            const float* const whole = int16Data.getSamples (0, lengths[l], int16Scratch);
+
+            if (std::memcmp (whole, source, sizeof (float) * (size_t) lengths[l]) != 0)
+            {
+                Logger::writeToLog ("  sample storage: int16 data doesn't give back its 16-bit source (" + String (lengths[l]) + " samples)");
+                return false;
+            }
+
+            for (int s = 0; s < numElementsInArray (readStarts); ++s)
+            {
+                for (int n = 0; n < numElementsInArray (readLengths); ++n)
+                {
+                    const float* const expected = int16Data.getSamples (readStarts[s], readLengths[n], int16Scratch);
+                    const float* const actual = compressedData.getSamples (readStarts[s], readLengths[n], compressedScratch);
+
+                    for (int i = 0; i < readLengths[n]; ++i)
+                    {
+                        if (std::memcmp (expected + i, actual + i, sizeof (float)) != 0)
+                        {
+                            Logger::writeToLog ("  sample storage: compressed data of " + String (lengths[l]) + " samples differs from int16 at sample "
+                                                  + String (readStarts[s] + i) + " (reading " + String (readLengths[n])
+                                                  + " from " + String (readStarts[s]) + "): " + String (expected[i]) + " vs " + String (actual[i]));
+                            return false;
+                        }
+                    }
+                }
+            }
+        }
+
+        Logger::writeToLog ("  sample storage: compressed data decodes exactly as int16");
+        return true;
+    }
+
+    //==============================================================================
+    /** A fixed sequence of notes, with times in seconds. Scripts end less than
+        three seconds after their last note, before any part goes idle and cuts
+        off its reverb, which the baseline doesn't do.
+    */
+    struct Script
+    {
+        Script (const String& scriptName, double length, float room)
+            : name (scriptName), lengthInSeconds (length), roomSize (room)
+        {
+        }
+
+        void addNote (double startTime, double duration, int midiChannel, int noteNumber, uint8 velocity)
+        {
+            sequence.addEvent (MidiMessage::noteOn (midiChannel, noteNumber, velocity), startTime);
+            sequence.addEvent (MidiMessage::noteOff (midiChannel, noteNumber), startTime + duration);
+        }
+
+        String name;
+        double lengthInSeconds;
+        float roomSize;
+        MidiMessageSequence sequence;
+    };
+
+    static void createScripts (OwnedArray<Script>& scripts)
+    {
+        // one note held through its sustain and left to ring out
+        Script* s = scripts.add (new Script ("single-note", 2.0, 0.5f));
+        s->addNote (0.0, 1.0, 1, 60, 100);
+
+        // a chord built up note by note, with the notes released at different times
+        s = scripts.add (new Script ("staggered-chord", 2.5, 0.2f));
+        s->addNote (0.0,  1.5, 1, 60, 90);
+        s->addNote (0.1,  1.2, 1, 64, 70);
+        s->addNote (0.25, 0.9, 1, 67, 110);
+        s->addNote (0.4,  1.1, 1, 72, 50);
+
+        // more notes than a part has voices, so that voices get stolen
+        s = scripts.add (new Script ("voice-stealing", 2.0, 0.0f));
+
+        for (int i = 0; i < 12; ++i)
+            s->addNote (0.05 * i, 0.8, 1, 48 + 3 * i, static_cast<uint8> (40 + 7 * i));
+
+        // several parts playing at once, so the parallel renderer has work to share out
+        s = scripts.add (new Script ("multi-part", 3.0, 0.8f));
+
+        for (int channel = 1; channel <= 6; ++channel)
+            for (int i = 0; i < 3; ++i)
+                s->addNote (0.3 * i + 0.07 * channel, 0.6, channel, 50 + 5 * channel + 4 * i, static_cast<uint8> (60 + 10 * i));
+
+        // short notes into a large room, so most of the output is the reverb's tail
+        s = scripts.add (new Script ("reverb-tail", 3.5, 1.0f));
+        s->addNote (0.0, 0.05, 2, 55, 127);
+        s->addNote (0.5, 0.05, 2, 62, 127);
+    }
+
+    //==============================================================================
+    /** Renders a script through a freshly made processor. */
+    static AudioBuffer<float> render (const Script& script, int numRenderThreads)
+    {
+        AndroidSynthProcessor processor;
+        processor.setNumRenderThreads (numRenderThreads);
+        setRoomSizes (processor, script.roomSize);
+
+        processor.setPlayConfigDetails (1, kNumOutputChannels, kSampleRate, kBlockSize);
+        processor.prepareToPlay (kSampleRate, kBlockSize);
+
+        // nothing runs the message loop during the render, so the parts the script plays get their storage up front
+        for (int i = 0; i < script.sequence.getNumEvents(); ++i)
+        {
+            const int channel = script.sequence.getEventPointer (i)->message.getChannel();
+
+            if (channel > 0)
+                processor.allocatePartStorage (channel - 1);
+        }
+
+        const int totalSamples = static_cast<int> (std::ceil (script.lengthInSeconds * kSampleRate));
+        AudioBuffer<float> output (kNumOutputChannels, totalSamples);
+        AudioBuffer<float> block (kNumOutputChannels, kBlockSize);
+        MidiBuffer midi;
+        int nextEvent = 0;
+
+        for (int start = 0; start < totalSamples; start += kBlockSize)
+        {
+            const int numSamples = jmin (kBlockSize, totalSamples - start);
+
+            block.setSize (kNumOutputChannels, numSamples, false, false, true);
+            block.clear();
+            getEventsForBlock (script, start, numSamples, nextEvent, midi);
+
+            processor.processBlock (block, midi);
+
+            for (int ch = 0; ch < kNumOutputChannels; ++ch)
+                output.copyFrom (ch, start, block, ch, 0, numSamples);
+        }
+
+        processor.releaseResources();
+        return output;
+    }
+
+    /** Renders a script the way the synth did before CompactSampler: a JUCE
+        Synthesiser of SamplerVoices and a reverb for each MIDI channel, all
+        playing the built-in sample kept as floats.
+    */
+    static AudioBuffer<float> renderBaseline (const Script& script)
+    {
+        AudioFormatManager formatManager;
+        formatManager.registerBasicFormats();
+
+        ScopedPointer<AudioFormatReader> reader (formatManager.findFormatForFileExtension ("ogg")
+                                                   ->createReaderFor (new MemoryInputStream (BinaryData::singing_ogg,
+                                                                                             BinaryData::singing_oggSize,
+                                                                                             false), true));
+        BigInteger midiNotes;
+        midiNotes.setRange (0, 126, true);
+
+        const SynthesiserSound::Ptr sound (new SamplerSound ("Voice", *reader, midiNotes, 0x40, 0.0, 0.0, 10.0));
+
+        OwnedArray<Synthesiser> synths;
+        OwnedArray<Reverb> reverbs;
+        OwnedArray<MidiBuffer> channelMidi;
+
+        Reverb::Parameters reverbParameters;
+        reverbParameters.roomSize = script.roomSize;
+
+        for (int i = 0; i < kNumBaselineChannels; ++i)
+        {
+            Synthesiser* const synth = synths.add (new Synthesiser());
+
+            for (int v = 0; v < kNumBaselineVoices; ++v)
+                synth->addVoice (new SamplerVoice());
+
+            synth->addSound (sound);
+            synth->setCurrentPlaybackSampleRate (kSampleRate);
+
+            reverbs.add (new Reverb())->setSampleRate (kSampleRate);
+            channelMidi.add (new MidiBuffer());
+        }
+
+        const int totalSamples = static_cast<int> (std::ceil (script.lengthInSeconds * kSampleRate));
+        AudioBuffer<float> output (kNumOutputChannels, totalSamples);
+        AudioBuffer<float> block (kNumOutputChannels, kBlockSize);
+        MidiBuffer midi;
+        uint32 usedChannels = 0;
+        int nextEvent = 0;
+
+        output.clear();
+
+        for (int start = 0; start < totalSamples; start += kBlockSize)
+        {
+            const int numSamples = jmin (kBlockSize, totalSamples - start);
+            getEventsForBlock (script, start, numSamples, nextEvent, midi);
+
+            MidiBuffer::Iterator it (midi);
+            MidiMessage message;
+            int samplePosition;
+
+            while (it.getNextEvent (message, samplePosition))
+            {
+                if (message.getChannel() > 0)
+                {
+                    channelMidi.getUnchecked (message.getChannel() - 1)->addEvent (message, samplePosition);
+                    usedChannels |= (1u << (message.getChannel() - 1));
+                }
+            }
+
+            // a channel that has never played anything would only render silence
+            for (int i = 0; i < kNumBaselineChannels; ++i)
+            {
+                if ((usedChannels & (1u << i)) == 0)
+                    continue;
+
+                block.clear();
+
+                reverbs.getUnchecked (i)->setParameters (reverbParameters);
+                synths.getUnchecked (i)->renderNextBlock (block, *channelMidi.getUnchecked (i), 0, numSamples);
+                reverbs.getUnchecked (i)->processMono (block.getWritePointer (0), numSamples);
+                channelMidi.getUnchecked (i)->clear();
+
+                for (int ch = 0; ch < kNumOutputChannels; ++ch)
+                    output.addFrom (ch, start, block, ch, 0, numSamples);
+            }
+        }
+
+        return output;
+    }
+
+    /** Fills midi with the script's events that fall within a block, timed from its start. */
+    static void getEventsForBlock (const Script& script, int start, int numSamples, int& nextEvent, MidiBuffer& midi)
+    {
+        midi.clear();
+
+        for (; nextEvent < script.sequence.getNumEvents(); ++nextEvent)
+        {
+            const MidiMessage& message = script.sequence.getEventPointer (nextEvent)->message;
+            const int position = roundToInt (message.getTimeStamp() * kSampleRate);
+
+            if (position >= start + numSamples)
+                break;
+
+            midi.addEvent (message, jmax (0, position - start));
+        }
+    }
+
+    static void setRoomSizes (AndroidSynthProcessor& processor, float roomSize)
+    {
+        const OwnedArray<AudioProcessorParameter>& params = processor.getParameters();
+
+        for (int i = 0; i < params.size(); ++i)
+            if (AudioParameterFloat* const param = dynamic_cast<AudioParameterFloat*> (params.getUnchecked (i)))
+                if (param->paramID.startsWith ("roomSize"))
+                    param->setValueNotifyingHost (param->range.convertTo0to1 (roomSize));
+    }
+
+    //==============================================================================
+    /** Renders the script again with each thread count and checks that nothing changed. */
+    static bool checkDeterminism (const Script& script, const AudioBuffer<float>& firstRender)
+    {
+        const int threadCounts[] = { 0, 1, 3 };
+        bool passed = true;
+
+        for (int i = 0; i < numElementsInArray (threadCounts); ++i)
+        {
+            const AudioBuffer<float> again (render (script, threadCounts[i]));
+            const Difference diff (firstRender, again, 0.0f);
+
+            if (diff.isMatch())
+                continue;
+
+            Logger::writeToLog ("  " + script.name + ": render with " + String (threadCounts[i])
+                                  + " thread(s) isn't bit-exact with the first render - " + diff.getDescription());
+            passed = false;
+        }
+
+        if (passed)
+            Logger::writeToLog ("  " + script.name + ": deterministic");
+
+        return passed;
+    }
+
+    /** Checks that the render's level follows the baseline's, window by window. */
+    static bool checkBaseline (const Script& script, const AudioBuffer<float>& output, const Options& options)
+    {
+        const AudioBuffer<float> baseline (renderBaseline (script));
+
+        if (baseline.getNumSamples() != output.getNumSamples() || baseline.getNumChannels() != output.getNumChannels())
+        {
+            Logger::writeToLog ("  " + script.name + ": baseline and render have different sizes");
+            return false;
+        }
+
+        const int numWindows = (output.getNumSamples() + kLevelWindowSize - 1) / kLevelWindowSize;
+        float loudest = 0.0f;
+
+        for (int ch = 0; ch < output.getNumChannels(); ++ch)
+            for (int w = 0; w < numWindows; ++w)
+                loudest = jmax (loudest, getWindowLevel (baseline, ch, w), getWindowLevel (output, ch, w));
+
+        const float floor = loudest * Decibels::decibelsToGain (kLevelFloorDb);
+        float worstDb = 0.0f;
+        int worstWindow = -1, worstChannel = -1;
+
+        for (int ch = 0; ch < output.getNumChannels(); ++ch)
+        {
+            for (int w = 0; w < numWindows; ++w)
+            {
+                const float expected = jmax (floor, getWindowLevel (baseline, ch, w));
+                const float actual = jmax (floor, getWindowLevel (output, ch, w));
+                const float differenceDb = std::abs (Decibels::gainToDecibels (actual / expected, -200.0f));
+
+                if (differenceDb > worstDb)
+                {
+                    worstDb = differenceDb;
+                    worstWindow = w;
+                    worstChannel = ch;
+                }
+            }
+        }
+
+        if (loudest > 0.0f && worstDb <= options.baselineToleranceDb)
+        {
+            Logger::writeToLog ("  " + script.name + ": follows the baseline (worst level difference " + String (worstDb, 2) + " dB)");
+            return true;
+        }
+
+        if (loudest <= 0.0f)
+            Logger::writeToLog ("  " + script.name + ": baseline and render are both silent");
+        else
+            Logger::writeToLog ("  " + script.name + ": level differs from the baseline by " + String (worstDb, 2)
+                                  + " dB in the window at " + String (worstWindow * kLevelWindowSize / kSampleRate, 3)
+                                  + " s (channel " + String (worstChannel) + "), baseline "
+                                  + String (Decibels::gainToDecibels (getWindowLevel (baseline, worstChannel, worstWindow)), 1)
+                                  + " dB, render " + String (Decibels::gainToDecibels (getWindowLevel (output, worstChannel, worstWindow)), 1) + " dB");
+        return false;
+    }
+
+    static float getWindowLevel (const AudioBuffer<float>& buffer, int channel, int window)
+    {
+        const int start = window * kLevelWindowSize;
+        return buffer.getRMSLevel (channel, start, jmin (kLevelWindowSize, buffer.getNumSamples() - start));
+    }
+
+    /** Compares a render with the script's reference, or replaces the reference if asked to. */
+    static bool checkReference (const Script& script, const AudioBuffer<float>& output, const Options& options)
+    {
+        const File referenceFile (options.referenceDirectory.getChildFile (script.name + ".wav"));
+        const File actualFile (options.referenceDirectory.getChildFile (script.name + ".actual.wav"));
+
+        if (options.updateReferences)
+        {
+            actualFile.deleteFile();
+
+            const bool written = writeWavFile (referenceFile, output);
+            Logger::writeToLog ("  " + script.name + ": " + (written ? "wrote " : "couldn't write ") + referenceFile.getFullPathName());
+            return written;
+        }
+
+        AudioBuffer<float> reference;
+
+        if (! readWavFile (referenceFile, reference))
+        {
+            Logger::writeToLog ("  " + script.name + ": no reference at " + referenceFile.getFullPathName()
+                                  + " - run with --update-references to create one");
+            return false;
+        }
+
+        const Difference diff (reference, output, options.tolerance);
+
+        if (diff.isMatch())
+        {
+            actualFile.deleteFile();
+            Logger::writeToLog ("  " + script.name + ": matches reference (peak error " + String (diff.peakError) + ")");
+            return true;
+        }
+
+        writeWavFile (actualFile, output);
+        Logger::writeToLog ("  " + script.name + ": differs from reference - " + diff.getDescription()
+                              + ", written to " + actualFile.getFullPathName());
+        return false;
+    }
+
+    //==============================================================================
+    /** How far one render is from another. */
+    struct Difference
+    {
+        Difference (const AudioBuffer<float>& expected, const AudioBuffer<float>& actual, float tolerance)
+            : sizesMatch (expected.getNumChannels() == actual.getNumChannels()
+                           && expected.getNumSamples() == actual.getNumSamples())
+        {
+            if (! sizesMatch)
+            {
+                expectedSize = String (expected.getNumChannels()) + "x" + String (expected.getNumSamples());
+                actualSize = String (actual.getNumChannels()) + "x" + String (actual.getNumSamples());
+                return;
+            }
+
+            double sumOfSquares = 0.0;
+
+            for (int ch = 0; ch < expected.getNumChannels(); ++ch)
+            {
+                const float* const e = expected.getReadPointer (ch);
+                const float* const a = actual.getReadPointer (ch);
+
+                for (int i = 0; i < expected.getNumSamples(); ++i)
+                {
+                    // compared by bits as well, so a tolerance of zero also catches a NaN or a -0
+                    const float error = std::abs (a[i] - e[i]);
+                    const bool diverges = (tolerance == 0.0f ? std::memcmp (a + i, e + i, sizeof (float)) != 0
+                                                             : ! (error <= tolerance));
+
+                    if (diverges && (firstDivergentSample < 0 || i < firstDivergentSample))
+                    {
+                        firstDivergentSample = i;
+                        firstDivergentChannel = ch;
+                    }
+
+                    if (error > peakError || error != error)
+                    {
+                        peakError = error;
+                        peakErrorSample = i;
+                        peakErrorChannel = ch;
+                    }
+
+                    sumOfSquares += static_cast<double> (error) * error;
+                }
+            }
+
+            rmsError = static_cast<float> (std::sqrt (sumOfSquares / jmax (1, expected.getNumChannels() * expected.getNumSamples())));
+        }
+
+        bool isMatch() const noexcept                               { return sizesMatch && firstDivergentSample < 0; }
+
+        String getDescription() const
+        {
+            if (! sizesMatch)
+                return "expected " + expectedSize + " samples but got " + actualSize;
+
+            return "first divergent sample " + String (firstDivergentSample) + " (channel " + String (firstDivergentChannel)
+                     + ", " + String (firstDivergentSample / kSampleRate, 4) + " s), peak error " + String (peakError)
+                     + " at sample " + String (peakErrorSample) + " (channel " + String (peakErrorChannel)
+                     + "), RMS error " + String (rmsError);
+        }
+
+        bool sizesMatch;
+        String expectedSize, actualSize;
+        float peakError = 0.0f, rmsError = 0.0f;
+        int peakErrorSample = -1, peakErrorChannel = -1;
+        int firstDivergentSample = -1, firstDivergentChannel = -1;
+    };
+
+    //==============================================================================
+    // references are kept as 32-bit float, so they hold a render exactly
+    static bool writeWavFile (const File& file, const AudioBuffer<float>& buffer)
+    {
+        file.deleteFile();
+
+        ScopedPointer<FileOutputStream> stream (file.createOutputStream());
+
+        if (stream == nullptr)
+            return false;
+
+        WavAudioFormat wav;
+        ScopedPointer<AudioFormatWriter> writer (wav.createWriterFor (stream, kSampleRate, static_cast<unsigned int> (buffer.getNumChannels()),
+                                                                      32, StringPairArray(), 0));
+        if (writer == nullptr)
+            return false;
+
+        stream.release();
+        return writer->writeFromAudioSampleBuffer (buffer, 0, buffer.getNumSamples());
+    }
+
+    static bool readWavFile (const File& file, AudioBuffer<float>& buffer)
+    {
+        if (! file.existsAsFile())
+            return false;
+
+        WavAudioFormat wav;
+        ScopedPointer<AudioFormatReader> reader (wav.createReaderFor (file.createInputStream(), true));
+
+        if (reader == nullptr)
+            return false;
+
+        buffer.setSize (static_cast<int> (reader->numChannels), static_cast<int> (reader->lengthInSamples));
+        reader->read (&buffer, 0, buffer.getNumSamples(), 0, true, true);
+        return true;
+    }
+};
+
+#endif // RENDERREGRESSION_H_INCLUDED
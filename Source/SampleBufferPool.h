@@ -0,0 +1,196 @@
+/*
+  ==============================================================================
+
+    Copyright (c) 2015 - ROLI Ltd.
+
+  ==============================================================================
+*/
+
+#ifndef SAMPLEBUFFERPOOL_H_INCLUDED
+#define SAMPLEBUFFERPOOL_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+//==============================================================================
+/** A fixed-size arena of equally sized slots for sample data.
+
+    The arena is allocated once, up front. Recording buffers and sound data
+    take whole slots and hand them back when they're done, so once the synth
+    has settled a record/swap cycle doesn't touch the heap. Requests that are
+    bigger than a slot, or that arrive when every slot is taken, fall back to
+    the heap and are counted as overflows.
+
+    Slots may be released from the audio thread (a voice can hold the last
+    reference to a sound), so the free list is guarded by a SpinLock and never
+    reallocates.
+*/
+class SampleBufferPool   : public ReferenceCountedObject
+{
+public:
+    //==============================================================================
+    typedef ReferenceCountedObjectPtr<SampleBufferPool> Ptr;
+
+    //==============================================================================
+    SampleBufferPool (size_t slotSizeInBytes, size_t arenaBudgetInBytes)
+        : slotSize ((slotSizeInBytes + kSlotAlignment - 1) & ~(kSlotAlignment - 1)),
+          numSlots (static_cast<int> (arenaBudgetInBytes / jmax ((size_t) 1, slotSize))),
+          arena (static_cast<size_t> (numSlots) * slotSize),
+          freeSlots (static_cast<size_t> (jmax (1, numSlots)))
+    {
+        for (int i = 0; i < numSlots; ++i)
+            freeSlots[i] = numSlots - 1 - i;
+
+        numFreeSlots = numSlots;
+    }
+
+    //==============================================================================
+    size_t getSlotSize() const noexcept                              { return slotSize; }
+
+    /** Returns a slot if numBytes fits and one is free, or heap memory otherwise. */
+    void* allocate (size_t numBytes)
+    {
+        if (numBytes <= slotSize)
+        {
+            const SpinLock::ScopedLockType sl (lock);
+
+            if (numFreeSlots > 0)
+            {
+                const int slot = freeSlots[--numFreeSlots];
+                highWaterMark = jmax (highWaterMark, numSlots - numFreeSlots);
+
+                return arena + static_cast<size_t> (slot) * slotSize;
+            }
+        }
+
+        {
+            const SpinLock::ScopedLockType sl (lock);
+            ++numOverflowAllocations;
+        }
+
+        return std::malloc (numBytes);
+    }
+
+    /** Gives back memory that was returned by allocate(). */
+    void release (void* data) noexcept
+    {
+        if (data == nullptr)
+            return;
+
+        if (isSlot (data))
+        {
+            const SpinLock::ScopedLockType sl (lock);
+            jassert (numFreeSlots < numSlots);
+
+            freeSlots[numFreeSlots++] = static_cast<int> (static_cast<size_t> (static_cast<const char*> (data) - arena.getData()) / slotSize);
+        }
+        else
+        {
+            std::free (data);
+        }
+    }
+
+    /** True if this block of memory is one of the arena's slots rather than an overflow. */
+    bool isSlot (const void* data) const noexcept
+    {
+        const char* const p = static_cast<const char*> (data);
+        return p >= arena.getData() && p < arena.getData() + static_cast<size_t> (numSlots) * slotSize;
+    }
+
+    //==============================================================================
+    struct Stats
+    {
+        size_t slotSizeInBytes;
+        int numSlots;
+        int numSlotsInUse;
+        int highWaterMark;
+        int numOverflowAllocations;
+    };
+
+    Stats getStats() const noexcept
+    {
+        const SpinLock::ScopedLockType sl (lock);
+
+        Stats stats;
+        stats.slotSizeInBytes = slotSize;
+        stats.numSlots = numSlots;
+        stats.numSlotsInUse = numSlots - numFreeSlots;
+        stats.highWaterMark = highWaterMark;
+        stats.numOverflowAllocations = numOverflowAllocations;
+
+        return stats;
+    }
+
+private:
+    //==============================================================================
+    static constexpr size_t kSlotAlignment = 16;
+
+    const size_t slotSize;
+    const int numSlots;
+    HeapBlock<char> arena;
+
+    mutable SpinLock lock;
+    HeapBlock<int> freeSlots;
+    int numFreeSlots = 0;
+    int highWaterMark = 0;
+    int numOverflowAllocations = 0;
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SampleBufferPool)
+};
+
+//==============================================================================
+/** Owns one block of memory from a SampleBufferPool, or from the heap if no
+    pool is given, and gives it back when it's freed or destroyed.
+*/
+class PooledSampleBuffer
+{
+public:
+    //==============================================================================
+    PooledSampleBuffer() noexcept {}
+    ~PooledSampleBuffer()                                            { free(); }
+
+    //==============================================================================
+    /** Makes sure there's room for numBytes, keeping the current block if it's
+        already big enough. The contents are not preserved if it has to grow.
+    */
+    void ensureSize (SampleBufferPool* poolToUse, size_t numBytes)
+    {
+        if (data != nullptr && numBytes <= capacity && poolToUse == pool.get())
+            return;
+
+        free();
+
+        if (numBytes == 0)
+            return;
+
+        pool = poolToUse;
+        data = (pool != nullptr ? pool->allocate (numBytes) : std::malloc (numBytes));
+        capacity = (pool != nullptr && pool->isSlot (data) ? pool->getSlotSize() : numBytes);
+    }
+
+    void free() noexcept
+    {
+        if (pool != nullptr)
+            pool->release (data);
+        else
+            std::free (data);
+
+        data = nullptr;
+        capacity = 0;
+        pool = nullptr;
+    }
+
+    //==============================================================================
+    void* getData() const noexcept                                   { return data; }
+    size_t getCapacity() const noexcept                              { return capacity; }
+
+private:
+    //==============================================================================
+    SampleBufferPool::Ptr pool;
+    void* data = nullptr;
+    size_t capacity = 0;
+
+    JUCE_DECLARE_NON_COPYABLE (PooledSampleBuffer)
+};
+
+#endif // SAMPLEBUFFERPOOL_H_INCLUDED
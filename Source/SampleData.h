@@ -0,0 +1,372 @@
+/*
+  ==============================================================================
+
+    Copyright (c) 2015 - ROLI Ltd.
+
+  ==============================================================================
+*/
+
+#ifndef SAMPLEDATA_H_INCLUDED
+#define SAMPLEDATA_H_INCLUDED
+
+#include "SampleBufferPool.h"
+
+#if JUCE_INTEL
+ #include <emmintrin.h>
+#elif defined (__ARM_NEON__) || defined (__ARM_NEON)
+ #include <arm_neon.h>
+#endif
+
+//==============================================================================
+/** One channel of PCM sample data held in memory in one of several formats.
+
+    float32 keeps the samples exactly as they were given. int16 quantises them
+    to 16 bits, which is all the precision our recordings have anyway. The
+    compressed format stores the same 16-bit values losslessly as bit-packed
+    deltas in fixed-size blocks, so any block can be decoded on its own.
+
+    Voices pull samples out with getSamples(), which converts to float on the
+    fly into a scratch buffer supplied by the caller.
+*/
+class SampleData
+{
+public:
+    //==============================================================================
+    enum Format
+    {
+        float32Samples = 0,
+        int16Samples,
+        compressedSamples
+    };
+
+    //==============================================================================
+    /** Creates an empty object whose storage will come from the given pool, or
+        from the heap if the pool is null.
+    */
+    explicit SampleData (SampleBufferPool* poolToUse = nullptr)
+        : pool (poolToUse)
+    {
+    }
+
+    SampleData (const float* source, int numSamplesToUse, Format formatToUse, SampleBufferPool* poolToUse = nullptr)
+        : pool (poolToUse)
+    {
+        setSamples (source, numSamplesToUse, formatToUse);
+    }
+
+    //==============================================================================
+    /** Replaces the contents, reusing the existing storage if it's big enough.
+        This mustn't be called while anything might be reading the data.
+    */
+    void setSamples (const float* source, int numSamplesToUse, Format formatToUse)
+    {
+        jassert (numSamplesToUse >= 0);
+
+        format = formatToUse;
+        length = numSamplesToUse;
+
+        switch (format)
+        {
+            case float32Samples:     storeAsFloat (source); break;
+            case int16Samples:       storeAsInt16 (source); break;
+            case compressedSamples:  storeCompressed (source); break;
+            default:                 jassertfalse; break;
+        }
+    }
+
+    /** Returns the most memory that numSamples could need in any of the formats. */
+    static size_t getMaxSizeInBytes (int numSamples) noexcept
+    {
+        const int numBlocks = getNumBlocks (numSamples);
+        const size_t maxCompressedSize = numBlocks * (sizeof (uint32) + getCompressedBlockSize (kBlockSize, 17));
+
+        return jmax (sizeof (float) * static_cast<size_t> (numSamples + kNumPaddingSamples), maxCompressedSize);
+    }
+
+    //==============================================================================
+    Format getFormat() const noexcept                                { return format; }
+    int getNumSamples() const noexcept                               { return length; }
+
+    /** Returns the number of bytes of sample storage this object holds. */
+    size_t getSizeInBytes() const noexcept                           { return numBytesUsed; }
+
+    //==============================================================================
+    /** Returns a pointer to numSamples float samples starting at startSample.
+
+        Samples outside the stored range read as zero. For float32 data this
+        usually points straight into the storage; otherwise the samples are
+        decoded into scratch, which must have room for numSamples floats.
+    */
+    const float* getSamples (int startSample, int numSamples, float* scratch) const noexcept
+    {
+        jassert (startSample >= 0 && numSamples >= 0);
+
+        if (format == float32Samples && startSample + numSamples <= length + kNumPaddingSamples)
+            return static_cast<const float*> (storage.getData()) + startSample;
+
+        const int numInRange = jlimit (0, numSamples, length - startSample);
+
+        if (numInRange > 0)
+        {
+            switch (format)
+            {
+                case float32Samples:
+                    FloatVectorOperations::copy (scratch, static_cast<const float*> (storage.getData()) + startSample, numInRange);
+                    break;
+
+                case int16Samples:
+                    convertInt16ToFloat (static_cast<const int16*> (storage.getData()) + startSample, scratch, numInRange);
+                    break;
+
+                case compressedSamples:
+                    decodeCompressed (startSample, numInRange, scratch);
+                    break;
+
+                default:
+                    jassertfalse;
+                    break;
+            }
+        }
+
+        if (numInRange < numSamples)
+            FloatVectorOperations::clear (scratch + jmax (0, numInRange), numSamples - jmax (0, numInRange));
+
+        return scratch;
+    }
+
+    //==============================================================================
+    /** Converts 16-bit PCM to floats in the range -1 to 1. */
+    static void convertInt16ToFloat (const int16* src, float* dest, int numSamples) noexcept
+    {
+        int i = 0;
+
+       #if JUCE_INTEL
+        const __m128 scale = _mm_set1_ps (kInt16ToFloat);
+
+        for (; i + 8 <= numSamples; i += 8)
+        {
+            const __m128i s = _mm_loadu_si128 (reinterpret_cast<const __m128i*> (src + i));
+            const __m128i lo = _mm_srai_epi32 (_mm_unpacklo_epi16 (s, s), 16);
+            const __m128i hi = _mm_srai_epi32 (_mm_unpackhi_epi16 (s, s), 16);
+
+            _mm_storeu_ps (dest + i,     _mm_mul_ps (_mm_cvtepi32_ps (lo), scale));
+            _mm_storeu_ps (dest + i + 4, _mm_mul_ps (_mm_cvtepi32_ps (hi), scale));
+        }
+       #elif defined (__ARM_NEON__) || defined (__ARM_NEON)
+        for (; i + 8 <= numSamples; i += 8)
+        {
+            const int16x8_t s = vld1q_s16 (src + i);
+
+            vst1q_f32 (dest + i,     vmulq_n_f32 (vcvtq_f32_s32 (vmovl_s16 (vget_low_s16 (s))),  kInt16ToFloat));
+            vst1q_f32 (dest + i + 4, vmulq_n_f32 (vcvtq_f32_s32 (vmovl_s16 (vget_high_s16 (s))), kInt16ToFloat));
+        }
+       #endif
+
+        for (; i < numSamples; ++i)
+            dest[i] = src[i] * kInt16ToFloat;
+    }
+
+    /** Quantises floats to 16-bit PCM the way AudioData::Int16 does, scaling by
+        32768 so that convertInt16ToFloat() gives back exactly the same values.
+    */
+    static int16 floatToInt16 (float sample) noexcept
+    {
+        return static_cast<int16> (jlimit (-32768, 32767, roundToInt (jlimit (-1.0f, 1.0f, sample) * 32768.0f)));
+    }
+
+private:
+    //==============================================================================
+    // Each compressed block starts with a header holding its first sample and the bit
+    // width of its remaining zig-zag coded deltas, which follow it tightly packed.
+    static constexpr int kBlockSize = 256;
+    static constexpr int kBlockHeaderBytes = 3;
+    static constexpr int kNumPaddingSamples = 4;
+    static constexpr float kInt16ToFloat = 1.0f / 32768.0f;
+
+    //==============================================================================
+    void storeAsFloat (const float* source)
+    {
+        numBytesUsed = sizeof (float) * static_cast<size_t> (length + kNumPaddingSamples);
+        storage.ensureSize (pool, numBytesUsed);
+
+        float* const dest = static_cast<float*> (storage.getData());
+        FloatVectorOperations::copy (dest, source, length);
+        FloatVectorOperations::clear (dest + length, kNumPaddingSamples);
+    }
+
+    void storeAsInt16 (const float* source)
+    {
+        numBytesUsed = sizeof (int16) * static_cast<size_t> (length);
+        storage.ensureSize (pool, numBytesUsed);
+
+        int16* const dest = static_cast<int16*> (storage.getData());
+
+        for (int i = 0; i < length; ++i)
+            dest[i] = floatToInt16 (source[i]);
+    }
+
+    // The compressed data starts with a table of the byte offset of each block.
+    void storeCompressed (const float* source)
+    {
+        const int numBlocks = getNumBlocks (length);
+        size_t totalBytes = sizeof (uint32) * static_cast<size_t> (numBlocks);
+
+        for (int block = 0; block < numBlocks; ++block)
+        {
+            const int num = jmin (kBlockSize, length - block * kBlockSize);
+            totalBytes += getCompressedBlockSize (num, getBitWidth (source + block * kBlockSize, num));
+        }
+
+        numBytesUsed = totalBytes;
+        storage.ensureSize (pool, numBytesUsed);
+
+        uint8* const data = static_cast<uint8*> (storage.getData());
+        uint32* const blockOffsets = reinterpret_cast<uint32*> (data);
+        size_t offset = sizeof (uint32) * static_cast<size_t> (numBlocks);
+
+        for (int block = 0; block < numBlocks; ++block)
+        {
+            const float* const blockSource = source + block * kBlockSize;
+            const int num = jmin (kBlockSize, length - block * kBlockSize);
+            const int bits = getBitWidth (blockSource, num);
+
+            blockOffsets[block] = static_cast<uint32> (offset);
+            encodeBlock (blockSource, num, bits, data + offset);
+            offset += getCompressedBlockSize (num, bits);
+        }
+
+        jassert (offset == numBytesUsed);
+    }
+
+    static void encodeBlock (const float* source, int numSamples, int bits, uint8* d) noexcept
+    {
+        int16 previous = floatToInt16 (source[0]);
+        const uint16 first = static_cast<uint16> (previous);
+
+        d[0] = static_cast<uint8> (first & 0xff);
+        d[1] = static_cast<uint8> (first >> 8);
+        d[2] = static_cast<uint8> (bits);
+        d += kBlockHeaderBytes;
+
+        uint64 accumulator = 0;
+        int bitsInAccumulator = 0;
+
+        for (int i = 1; i < numSamples; ++i)
+        {
+            const int16 sample = floatToInt16 (source[i]);
+
+            accumulator |= static_cast<uint64> (zigZag (sample - previous)) << bitsInAccumulator;
+            bitsInAccumulator += bits;
+            previous = sample;
+
+            while (bitsInAccumulator >= 8)
+            {
+                *d++ = static_cast<uint8> (accumulator & 0xff);
+                accumulator >>= 8;
+                bitsInAccumulator -= 8;
+            }
+        }
+
+        if (bitsInAccumulator > 0)
+            *d = static_cast<uint8> (accumulator & 0xff);
+    }
+
+    /** Returns the number of bits needed for the largest zig-zag coded delta in a block. */
+    static int getBitWidth (const float* source, int numSamples) noexcept
+    {
+        uint32 allCodes = 0;
+        int16 previous = floatToInt16 (source[0]);
+
+        for (int i = 1; i < numSamples; ++i)
+        {
+            const int16 sample = floatToInt16 (source[i]);
+            allCodes |= zigZag (sample - previous);
+            previous = sample;
+        }
+
+        int bits = 0;
+
+        while ((allCodes >> bits) != 0)
+            ++bits;
+
+        return bits;
+    }
+
+    static int getNumBlocks (int numSamples) noexcept                { return (numSamples + kBlockSize - 1) / kBlockSize; }
+
+    static size_t getCompressedBlockSize (int numSamples, int bits) noexcept
+    {
+        return static_cast<size_t> (kBlockHeaderBytes + ((numSamples - 1) * bits + 7) / 8);
+    }
+
+    //==============================================================================
+    void decodeCompressed (int startSample, int numSamples, float* dest) const noexcept
+    {
+        int16 block[kBlockSize];
+
+        while (numSamples > 0)
+        {
+            const int blockIndex = startSample / kBlockSize;
+            const int offsetInBlock = startSample - blockIndex * kBlockSize;
+            const int numInBlock = jmin (kBlockSize, length - blockIndex * kBlockSize);
+            const int numToDecode = jmin (numSamples, numInBlock - offsetInBlock);
+
+            decodeBlock (blockIndex, numInBlock, offsetInBlock + numToDecode, block);
+            convertInt16ToFloat (block + offsetInBlock, dest, numToDecode);
+
+            dest += numToDecode;
+            startSample += numToDecode;
+            numSamples -= numToDecode;
+        }
+    }
+
+    /** Decodes the first numToDecode samples of a block. */
+    void decodeBlock (int blockIndex, int numInBlock, int numToDecode, int16* dest) const noexcept
+    {
+        ignoreUnused (numInBlock);
+        jassert (numToDecode <= numInBlock);
+
+        const uint8* const data = static_cast<const uint8*> (storage.getData());
+        const uint8* d = data + reinterpret_cast<const uint32*> (data)[blockIndex];
+        const int bits = d[2];
+        const uint32 mask = (1u << bits) - 1u;
+
+        int32 sample = static_cast<int16> (static_cast<uint16> (d[0] | (d[1] << 8)));
+        dest[0] = static_cast<int16> (sample);
+        d += kBlockHeaderBytes;
+
+        uint64 accumulator = 0;
+        int bitsInAccumulator = 0;
+
+        for (int i = 1; i < numToDecode; ++i)
+        {
+            while (bitsInAccumulator < bits)
+            {
+                accumulator |= static_cast<uint64> (*d++) << bitsInAccumulator;
+                bitsInAccumulator += 8;
+            }
+
+            sample += unZigZag (static_cast<uint32> (accumulator) & mask);
+            accumulator >>= bits;
+            bitsInAccumulator -= bits;
+
+            dest[i] = static_cast<int16> (sample);
+        }
+    }
+
+    static uint32 zigZag (int32 delta) noexcept         { return (static_cast<uint32> (delta) << 1) ^ static_cast<uint32> (delta >> 31); }
+    static int32 unZigZag (uint32 code) noexcept        { return static_cast<int32> (code >> 1) ^ -static_cast<int32> (code & 1); }
+
+    //==============================================================================
+    SampleBufferPool::Ptr pool;
+    PooledSampleBuffer storage;
+    size_t numBytesUsed = 0;
+
+    Format format = float32Samples;
+    int length = 0;
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SampleData)
+};
+
+#endif // SAMPLEDATA_H_INCLUDED
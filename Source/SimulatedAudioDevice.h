@@ -0,0 +1,290 @@
+/*
+  ==============================================================================
+
+    Copyright (c) 2015 - ROLI Ltd.
+
+  ==============================================================================
+*/
+
+#ifndef SIMULATEDAUDIODEVICE_H_INCLUDED
+#define SIMULATEDAUDIODEVICE_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+//==============================================================================
+/** A fake audio device whose output is fed back into its input after a fixed
+    delay, for testing the latency tuner on machines without a loopback cable.
+
+    It runs the callback on its own thread, paced by the system clock. Below a
+    given buffer size it stalls every so often, the way an overloaded device
+    would, so the tuner has a real limit to find.
+*/
+class SimulatedLoopbackDevice   : public AudioIODevice,
+                                  private Thread
+{
+public:
+    //==============================================================================
+    struct Settings
+    {
+        double sampleRate = 48000.0;
+        int defaultBufferSize = 512;
+        int minStableBufferSize = 128;      // smaller buffers stall now and then
+        int extraLatencySamples = 96;       // on top of one buffer in and one out
+    };
+
+    //==============================================================================
+    SimulatedLoopbackDevice (const String& deviceName, const String& typeName, const Settings& settingsToUse)
+        : AudioIODevice (deviceName, typeName),
+          Thread ("Simulated audio device"),
+          settings (settingsToUse)
+    {
+    }
+
+    ~SimulatedLoopbackDevice()
+    {
+        close();
+    }
+
+    //==============================================================================
+    StringArray getOutputChannelNames() override
+    {
+        StringArray names;
+        names.add ("Output 1");
+        names.add ("Output 2");
+        return names;
+    }
+
+    StringArray getInputChannelNames() override
+    {
+        StringArray names;
+        names.add ("Input 1");
+        return names;
+    }
+
+    Array<double> getAvailableSampleRates() override
+    {
+        Array<double> rates;
+        rates.add (settings.sampleRate);
+        return rates;
+    }
+
+    Array<int> getAvailableBufferSizes() override
+    {
+        Array<int> sizes;
+
+        for (int size = 32; size <= 2048; size *= 2)
+            sizes.add (size);
+
+        return sizes;
+    }
+
+    int getDefaultBufferSize() override                             { return settings.defaultBufferSize; }
+
+    //==============================================================================
+    String open (const BigInteger& inputChannels, const BigInteger& outputChannels,
+                 double /*sampleRate*/, int bufferSizeSamples) override
+    {
+        close();
+
+        bufferSize = bufferSizeSamples > 0 ? bufferSizeSamples : settings.defaultBufferSize;
+        activeInputs = inputChannels;
+        activeInputs.setRange (1, activeInputs.getHighestBit() + 1, false);
+        activeOutputs = outputChannels;
+        activeOutputs.setRange (2, activeOutputs.getHighestBit() + 1, false);
+
+        inputBuffer.setSize (1, bufferSize);
+        outputBuffer.setSize (2, bufferSize);
+
+        loopback.setSize (1, nextPowerOfTwo (getRoundTripLatency() + bufferSize + 1));
+        loopback.clear();
+        loopbackPosition = 0;
+
+        isDeviceOpen = true;
+        return String();
+    }
+
+    void close() override
+    {
+        stop();
+        isDeviceOpen = false;
+    }
+
+    bool isOpen() override                                          { return isDeviceOpen; }
+
+    void start (AudioIODeviceCallback* newCallback) override
+    {
+        if (! isDeviceOpen || newCallback == nullptr || isThreadRunning())
+            return;
+
+        newCallback->audioDeviceAboutToStart (this);
+
+        {
+            const ScopedLock sl (callbackLock);
+            callback = newCallback;
+        }
+
+        startThread (9);
+    }
+
+    void stop() override
+    {
+        stopThread (1000);
+
+        AudioIODeviceCallback* oldCallback;
+
+        {
+            const ScopedLock sl (callbackLock);
+            oldCallback = callback;
+            callback = nullptr;
+        }
+
+        if (oldCallback != nullptr)
+            oldCallback->audioDeviceStopped();
+    }
+
+    bool isPlaying() override                                       { return callback != nullptr; }
+    String getLastError() override                                  { return String(); }
+
+    //==============================================================================
+    int getCurrentBufferSizeSamples() override                      { return bufferSize; }
+    double getCurrentSampleRate() override                          { return settings.sampleRate; }
+    int getCurrentBitDepth() override                               { return 32; }
+
+    BigInteger getActiveOutputChannels() const override             { return activeOutputs; }
+    BigInteger getActiveInputChannels() const override              { return activeInputs; }
+
+    int getOutputLatencyInSamples() override                        { return bufferSize; }
+    int getInputLatencyInSamples() override                         { return bufferSize; }
+
+    /** The delay between a sample being written to the output and read back from the input. */
+    int getRoundTripLatency() const noexcept                        { return 2 * bufferSize + settings.extraLatencySamples; }
+
+private:
+    //==============================================================================
+    static constexpr int kCallbacksBetweenStalls = 50;
+
+    //==============================================================================
+    void run() override
+    {
+        const double bufferMs = 1000.0 * bufferSize / settings.sampleRate;
+        double nextCallbackMs = Time::getMillisecondCounterHiRes();
+        int callbackCount = 0;
+
+        while (! threadShouldExit())
+        {
+            renderBlock();
+
+            nextCallbackMs += bufferMs;
+
+            // an unstable buffer size occasionally misses its deadline by a couple of buffers
+            if (bufferSize < settings.minStableBufferSize && ++callbackCount % kCallbacksBetweenStalls == 0)
+                nextCallbackMs += 2.0 * bufferMs + 5.0;
+
+            while (! threadShouldExit())
+            {
+                const double msToWait = nextCallbackMs - Time::getMillisecondCounterHiRes();
+
+                if (msToWait <= 0.0)
+                    break;
+
+                if (msToWait > 2.0)
+                    Thread::sleep (1);
+                else
+                    Thread::yield();
+            }
+        }
+    }
+
+    void renderBlock()
+    {
+        const int mask = loopback.getNumSamples() - 1;
+        const int delay = getRoundTripLatency();
+
+        // the input is whatever went out round-trip-latency samples ago
+        for (int i = 0; i < bufferSize; ++i)
+            inputBuffer.setSample (0, i, loopback.getSample (0, (loopbackPosition + i - delay) & mask));
+
+        outputBuffer.clear();
+
+        {
+            const ScopedLock sl (callbackLock);
+
+            if (callback != nullptr)
+            {
+                const float* inputs[] = { activeInputs[0] ? inputBuffer.getReadPointer (0) : nullptr };
+                float* outputs[] = { outputBuffer.getWritePointer (0), outputBuffer.getWritePointer (1) };
+
+                callback->audioDeviceIOCallback (inputs, activeInputs[0] ? 1 : 0,
+                                                 outputs, activeOutputs.countNumberOfSetBits(), bufferSize);
+            }
+        }
+
+        for (int i = 0; i < bufferSize; ++i)
+            loopback.setSample (0, (loopbackPosition + i) & mask, outputBuffer.getSample (0, i));
+
+        loopbackPosition = (loopbackPosition + bufferSize) & mask;
+    }
+
+    //==============================================================================
+    const Settings settings;
+
+    CriticalSection callbackLock;
+    AudioIODeviceCallback* callback = nullptr;
+
+    bool isDeviceOpen = false;
+    int bufferSize = 0;
+    BigInteger activeInputs, activeOutputs;
+
+    AudioBuffer<float> inputBuffer, outputBuffer, loopback;
+    int loopbackPosition = 0;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SimulatedLoopbackDevice)
+};
+
+//==============================================================================
+/** The device type that provides a single SimulatedLoopbackDevice. */
+class SimulatedLoopbackDeviceType   : public AudioIODeviceType
+{
+public:
+    //==============================================================================
+    explicit SimulatedLoopbackDeviceType (const SimulatedLoopbackDevice::Settings& settingsToUse = SimulatedLoopbackDevice::Settings())
+        : AudioIODeviceType (getTypeName()),
+          settings (settingsToUse)
+    {
+    }
+
+    static String getTypeName()                                     { return "Simulated Loopback"; }
+
+    //==============================================================================
+    void scanForDevices() override                                  {}
+
+    StringArray getDeviceNames (bool /*wantInputNames*/) const override
+    {
+        return StringArray (getTypeName());
+    }
+
+    int getDefaultDeviceIndex (bool /*forInput*/) const override    { return 0; }
+
+    int getIndexOfDevice (AudioIODevice* device, bool /*asInput*/) const override
+    {
+        return dynamic_cast<SimulatedLoopbackDevice*> (device) != nullptr ? 0 : -1;
+    }
+
+    bool hasSeparateInputsAndOutputs() const override               { return false; }
+
+    AudioIODevice* createDevice (const String& outputDeviceName, const String& inputDeviceName) override
+    {
+        if (outputDeviceName == getTypeName() || inputDeviceName == getTypeName())
+            return new SimulatedLoopbackDevice (getTypeName(), getTypeName(), settings);
+
+        return nullptr;
+    }
+
+private:
+    //==============================================================================
+    const SimulatedLoopbackDevice::Settings settings;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SimulatedLoopbackDeviceType)
+};
+
+#endif // SIMULATEDAUDIODEVICE_H_INCLUDED
@@ -0,0 +1,136 @@
+/*
+  ==============================================================================
+
+    Copyright (c) 2015 - ROLI Ltd.
+
+  ==============================================================================
+*/
+
+#ifndef SUSTAINLOOPFINDER_H_INCLUDED
+#define SUSTAINLOOPFINDER_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+//==============================================================================
+/** Picks sustain loop points in a sample and bakes a crossfade into it.
+
+    Both loop points sit on rising zero crossings. The end point is the one
+    nearest its target position. The start point is the candidate near its own
+    target whose slope best matches the end's. The crossfade then blends the
+    samples leading up to the loop end into the ones leading up to the loop
+    start. The sample at the loop end is set equal to the one at the loop
+    start, so a voice can interpolate across the wrap without special-casing it.
+*/
+class SustainLoopFinder
+{
+public:
+    //==============================================================================
+    struct Settings
+    {
+        bool enabled = true;
+        float startPosition = 0.3f;     // where to look for the loop start, as a proportion of the length
+        float endPosition = 0.8f;       // where to look for the loop end, as a proportion of the length
+        double searchSeconds = 0.01;
+        double minLoopSeconds = 0.05;
+        double crossfadeSeconds = 0.03;
+    };
+
+    struct LoopPoints
+    {
+        int start;
+        int end;
+        int crossfadeLength;
+        bool isValid;
+    };
+
+    //==============================================================================
+    static LoopPoints find (const float* samples, int numSamples, double sampleRate, const Settings& settings)
+    {
+        LoopPoints loop = { 0, 0, 0, false };
+
+        if (! settings.enabled || numSamples < 4)
+            return loop;
+
+        const int searchRange = jmax (1, roundToInt (settings.searchSeconds * sampleRate));
+
+        const int end = findNearestRisingZeroCrossing (samples, numSamples,
+                                                       roundToInt (settings.endPosition * (numSamples - 2)), searchRange);
+        if (end < 0)
+            return loop;
+
+        const float endSlope = samples[end] - samples[end - 1];
+        const int startTarget = roundToInt (settings.startPosition * (numSamples - 2));
+        float bestSlopeError = std::numeric_limits<float>::max();
+        int start = -1;
+
+        for (int i = jmax (1, startTarget - searchRange); i <= jmin (end - 1, startTarget + searchRange); ++i)
+        {
+            if (isRisingZeroCrossing (samples, i))
+            {
+                const float slopeError = std::abs ((samples[i] - samples[i - 1]) - endSlope);
+
+                if (slopeError < bestSlopeError)
+                {
+                    bestSlopeError = slopeError;
+                    start = i;
+                }
+            }
+        }
+
+        if (start < 0 || end - start < roundToInt (settings.minLoopSeconds * sampleRate))
+            return loop;
+
+        loop.start = start;
+        loop.end = end;
+        loop.crossfadeLength = jmin (roundToInt (settings.crossfadeSeconds * sampleRate), start, (end - start) / 2);
+        loop.isValid = true;
+
+        return loop;
+    }
+
+    /** Writes the crossfade and the wrap sample into the data. The sample must
+        extend at least one sample past the loop end.
+    */
+    static void applyCrossfade (float* samples, const LoopPoints& loop) noexcept
+    {
+        jassert (loop.isValid);
+
+        const int fadeLength = loop.crossfadeLength;
+        float* const fadeOut = samples + loop.end - fadeLength;
+        const float* const fadeIn = samples + loop.start - fadeLength;
+
+        for (int i = 0; i < fadeLength; ++i)
+        {
+            const float alpha = (i + 1) / static_cast<float> (fadeLength);
+            fadeOut[i] = fadeOut[i] * (1.0f - alpha) + fadeIn[i] * alpha;
+        }
+
+        samples[loop.end] = samples[loop.start];
+    }
+
+private:
+    //==============================================================================
+    static bool isRisingZeroCrossing (const float* samples, int index) noexcept
+    {
+        return samples[index - 1] < 0.0f && samples[index] >= 0.0f;
+    }
+
+    /** Returns the rising zero crossing closest to target, or -1 if there isn't one within range. */
+    static int findNearestRisingZeroCrossing (const float* samples, int numSamples, int target, int range) noexcept
+    {
+        for (int offset = 0; offset <= range; ++offset)
+        {
+            if (target - offset >= 1 && isRisingZeroCrossing (samples, target - offset))
+                return target - offset;
+
+            if (target + offset < numSamples - 1 && isRisingZeroCrossing (samples, target + offset))
+                return target + offset;
+        }
+
+        return -1;
+    }
+
+    JUCE_DECLARE_NON_COPYABLE (SustainLoopFinder)
+};
+
+#endif // SUSTAINLOOPFINDER_H_INCLUDED
@@ -0,0 +1,230 @@
+/*
+  ==============================================================================
+
+    Copyright (c) 2015 - ROLI Ltd.
+
+  ==============================================================================
+*/
+
+#ifndef SYNTHPART_H_INCLUDED
+#define SYNTHPART_H_INCLUDED
+
+#include "CompactSampler.h"
+
+//==============================================================================
+/** One timbre of the multi-timbral engine.
+
+    A part listens to a single MIDI channel and owns its own voice pool, sound
+    and reverb. It renders into a private buffer which the processor then sums
+    into the output. Once all voices and the reverb tail have died away the part
+    goes idle and is skipped entirely until it receives MIDI again.
+
+    The reverb and output buffer are the bulk of a part's memory, so a part
+    only gets them (see createStorage()) once its channel is first played.
+    Until then it holds on to the events it's sent, and can't be rendered.
+*/
+class SynthPart
+{
+public:
+    //==============================================================================
+    SynthPart (int midiChannelToUse, AudioParameterFloat& roomSizeParameter, int numVoices)
+        : midiChannel (midiChannelToUse),
+          roomSizeParam (roomSizeParameter),
+          synth (numVoices)
+    {
+    }
+
+    //==============================================================================
+    /** The state a part only needs once it's being played. */
+    struct Storage
+    {
+        Reverb reverb;
+        AudioBuffer<float> output;
+    };
+
+    //==============================================================================
+    void prepareToPlay (double sampleRate, int maxBlockSize, int numChannels)
+    {
+        lastSampleRate = sampleRate;
+        lastMaxBlockSize = maxBlockSize;
+        lastNumChannels = jmax (1, numChannels);
+
+        midiMessages.ensureSize (kMidiBufferBytes);
+
+        tailLengthInSamples = static_cast<int> (std::ceil (kReverbTailSeconds * sampleRate));
+        samplesUntilIdle = 0;
+
+        synth.setCurrentPlaybackSampleRate (sampleRate);
+
+        if (storage != nullptr)
+            prepareStorage (*storage);
+    }
+
+    void releaseResources()
+    {
+        storage = nullptr;
+        midiMessages.clear();
+        numHeldEvents = 0;
+        samplesUntilIdle = 0;
+    }
+
+    //==============================================================================
+    bool hasStorage() const noexcept                                 { return storage != nullptr; }
+
+    /** True if the part has been sent MIDI that it can't play until it has its storage. */
+    bool needsStorage() const noexcept                               { return storageRequested.get() != 0 && storage == nullptr; }
+
+    /** Allocates a reverb and output buffer for the settings of the last prepareToPlay().
+        This allocates, so it must not be called on the audio thread.
+    */
+    Storage* createStorage() const
+    {
+        Storage* const newStorage = new Storage();
+        prepareStorage (*newStorage);
+        return newStorage;
+    }
+
+    /** Swaps in storage made by createStorage(), handing back what the part had before.
+        The caller must make sure the part isn't being rendered at the same time.
+    */
+    void swapStorage (ScopedPointer<Storage>& newStorage) noexcept
+    {
+        storage.swapWith (newStorage);
+        storageRequested.set (0);
+    }
+
+    //==============================================================================
+    void setSound (const SynthesiserSound::Ptr& newSound)
+    {
+        synth.removeSound (0);
+        sound = newSound;
+
+        if (sound != nullptr)
+            synth.addSound (sound);
+    }
+
+    SynthesiserSound::Ptr getSound() const noexcept                 { return sound; }
+
+    /** Copies the sample positions of this part's playing voices; see CompactSynthesiser. */
+    int getPlayheadPositions (int* dest, int maxPositions) const noexcept
+    {
+        return synth.getPlayheadPositions (dest, maxPositions);
+    }
+
+    //==============================================================================
+    int getMidiChannel() const noexcept                              { return midiChannel; }
+
+    /** Adds an event for the next render, and returns true if the part can be
+        rendered. A part with no storage yet keeps a limited number of events,
+        played from the start of its first block, so that its buffer never has
+        to grow on the audio thread; it returns false and asks for storage.
+    */
+    bool addEvent (const MidiMessage& message, int samplePosition)
+    {
+        if (storage != nullptr)
+        {
+            midiMessages.addEvent (message, samplePosition);
+            return true;
+        }
+
+        if (numHeldEvents < kMaxHeldEvents)
+        {
+            midiMessages.addEvent (message, 0);
+            ++numHeldEvents;
+        }
+
+        storageRequested.set (1);
+        return false;
+    }
+
+    /** True once the voices and the reverb tail have fully decayed. */
+    bool isIdle() const noexcept                                     { return samplesUntilIdle <= 0 && midiMessages.isEmpty(); }
+
+    //==============================================================================
+    /** Renders the next block into this part's private output buffer.
+        This may be called from a worker thread, so it must only touch state
+        that belongs to this part.
+    */
+    void render (int numSamples)
+    {
+        jassert (storage != nullptr);
+
+        AudioBuffer<float>& output = storage->output;
+        Reverb& reverb = storage->reverb;
+
+        if (numSamples > output.getNumSamples())
+            output.setSize (output.getNumChannels(), numSamples, false, false, true);
+
+        output.clear (0, numSamples);
+
+        Reverb::Parameters reverbParameters;
+        reverbParameters.roomSize = roomSizeParam.get();
+
+        reverb.setParameters (reverbParameters);
+        synth.renderNextBlock (output, midiMessages, 0, numSamples);
+        reverb.processMono (output.getWritePointer (0), numSamples);
+
+        if (! midiMessages.isEmpty() || hasActiveVoices())
+        {
+            samplesUntilIdle = tailLengthInSamples;
+        }
+        else if ((samplesUntilIdle -= numSamples) <= 0)
+        {
+            samplesUntilIdle = 0;
+            reverb.reset();
+        }
+
+        midiMessages.clear();
+        numHeldEvents = 0;
+    }
+
+    const AudioBuffer<float>& getOutput() const noexcept             { return storage->output; }
+
+private:
+    //==============================================================================
+    bool hasActiveVoices() const
+    {
+        for (int i = synth.getNumVoices(); --i >= 0;)
+            if (synth.getVoice (i)->isVoiceActive())
+                return true;
+
+        return false;
+    }
+
+    void prepareStorage (Storage& s) const
+    {
+        s.output.setSize (lastNumChannels, jmax (1, lastMaxBlockSize));
+
+        if (lastSampleRate > 0.0)
+            s.reverb.setSampleRate (lastSampleRate);
+
+        s.reverb.reset();
+    }
+
+    //==============================================================================
+    static constexpr double kReverbTailSeconds = 3.0;
+    static constexpr int kMidiBufferBytes = 2048;
+    static constexpr int kMaxHeldEvents = 64;     // small channel messages, well within kMidiBufferBytes
+
+    //==============================================================================
+    const int midiChannel;
+    AudioParameterFloat& roomSizeParam;
+
+    CompactSynthesiser synth;
+    SynthesiserSound::Ptr sound;
+    ScopedPointer<Storage> storage;
+    Atomic<int> storageRequested;
+
+    MidiBuffer midiMessages;
+    int numHeldEvents = 0;
+
+    double lastSampleRate = 0.0;
+    int lastMaxBlockSize = 0, lastNumChannels = 1;
+    int tailLengthInSamples = 0;
+    int samplesUntilIdle = 0;
+
+    //==============================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SynthPart)
+};
+
+#endif // SYNTHPART_H_INCLUDED
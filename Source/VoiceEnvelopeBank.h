@@ -0,0 +1,282 @@
+/*
+  ==============================================================================
+
+    Copyright (c) 2015 - ROLI Ltd.
+
+  ==============================================================================
+*/
+
+#ifndef VOICEENVELOPEBANK_H_INCLUDED
+#define VOICEENVELOPEBANK_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+#if JUCE_INTEL
+ #include <xmmintrin.h>
+#elif defined (__ARM_NEON__) || defined (__ARM_NEON)
+ #include <arm_neon.h>
+#endif
+
+//==============================================================================
+/** ADSR envelopes for all the voices of a synthesiser, computed a block at a time.
+
+    The state of every envelope lives in parallel arrays indexed by voice. Once
+    per block, process() writes an array of gains for each voice that's in an
+    attack, decay or release stage. Voices that are sustaining just use a single
+    level. Each segment is an exponential curve towards a target slightly past
+    the stage's end level, so the number of samples until the stage ends can be
+    worked out in advance and the curve filled in four samples at a time.
+*/
+class VoiceEnvelopeBank
+{
+public:
+    //==============================================================================
+    struct Parameters
+    {
+        double attackSeconds = 0.0;
+        double decaySeconds = 0.0;
+        float sustainLevel = 1.0f;
+        double releaseSeconds = 0.0;
+    };
+
+    enum Stage
+    {
+        idle = 0,
+        attack,
+        decay,
+        sustain,
+        release
+    };
+
+    //==============================================================================
+    VoiceEnvelopeBank() {}
+
+    /** Allocates the state for a number of voices, each rendered at most maxBlockSize samples at a time. */
+    void setNumVoices (int newNumVoices, int newMaxBlockSize)
+    {
+        numVoices = newNumVoices;
+        maxBlockSize = newMaxBlockSize;
+
+        const size_t n = static_cast<size_t> (jmax (1, numVoices));
+
+        stages.calloc (n);
+        levels.calloc (n);
+        sustainLevels.calloc (n);
+        numActiveSamples.calloc (n);
+        isSustaining.calloc (n);
+
+        for (int i = 0; i < numSegments; ++i)
+        {
+            coefficients[i].calloc (n);
+            targets[i].calloc (n);
+        }
+
+        gains.calloc (n * static_cast<size_t> (maxBlockSize));
+    }
+
+    int getNumVoices() const noexcept                                { return numVoices; }
+    int getMaxBlockSize() const noexcept                             { return maxBlockSize; }
+
+    //==============================================================================
+    void noteOn (int voice, const Parameters& params, double sampleRate) noexcept
+    {
+        jassert (isPositiveAndBelow (voice, numVoices));
+
+        const float sustainLevel = jlimit (0.0f, 1.0f, params.sustainLevel);
+
+        setSegment (attackSegment,  voice, params.attackSeconds  * sampleRate, 1.0f, 1.0f, kAttackTargetRatio);
+        setSegment (decaySegment,   voice, params.decaySeconds   * sampleRate, sustainLevel, 1.0f - sustainLevel, kDecayReleaseTargetRatio);
+        setSegment (releaseSegment, voice, params.releaseSeconds * sampleRate, 0.0f, 1.0f, kDecayReleaseTargetRatio);
+
+        sustainLevels[voice] = sustainLevel;
+        levels[voice] = 0.0f;
+        stages[voice] = attack;
+    }
+
+    void noteOff (int voice) noexcept
+    {
+        if (stages[voice] != idle)
+            stages[voice] = release;
+    }
+
+    void reset (int voice) noexcept
+    {
+        stages[voice] = idle;
+        levels[voice] = 0.0f;
+    }
+
+    //==============================================================================
+    /** Advances every active envelope by numSamples, which must be no more than the maximum block size. */
+    void process (int numSamples) noexcept
+    {
+        jassert (numSamples <= maxBlockSize);
+
+        for (int voice = 0; voice < numVoices; ++voice)
+        {
+            isSustaining[voice] = (stages[voice] == sustain);
+
+            if (isSustaining[voice])
+            {
+                numActiveSamples[voice] = numSamples;
+                continue;
+            }
+
+            float* const voiceGains = gains + static_cast<size_t> (voice) * static_cast<size_t> (maxBlockSize);
+            int done = 0;
+
+            while (done < numSamples && stages[voice] != idle && stages[voice] != sustain)
+                done += renderStage (voice, voiceGains + done, numSamples - done);
+
+            if (stages[voice] == sustain)
+            {
+                FloatVectorOperations::fill (voiceGains + done, levels[voice], numSamples - done);
+                done = numSamples;
+            }
+
+            numActiveSamples[voice] = done;
+        }
+    }
+
+    //==============================================================================
+    /** True if the voice's level in the last block came from getGains() rather than getLevel(). */
+    bool usesGains (int voice) const noexcept                       { return ! isSustaining[voice]; }
+
+    /** The per-sample gains for the voice's last block. */
+    const float* getGains (int voice) const noexcept                { return gains + static_cast<size_t> (voice) * static_cast<size_t> (maxBlockSize); }
+
+    /** The voice's current level, which is constant throughout a block while it sustains. */
+    float getLevel (int voice) const noexcept                       { return levels[voice]; }
+
+    /** How many samples of the last block the voice was sounding for before its release finished. */
+    int getNumActiveSamples (int voice) const noexcept              { return numActiveSamples[voice]; }
+
+    Stage getStage (int voice) const noexcept                       { return static_cast<Stage> (stages[voice]); }
+
+private:
+    //==============================================================================
+    enum Segment
+    {
+        attackSegment = 0,
+        decaySegment,
+        releaseSegment,
+        numSegments
+    };
+
+    // how far past its end level each curve aims, as a proportion of its height
+    static constexpr float kAttackTargetRatio = 0.3f;
+    static constexpr float kDecayReleaseTargetRatio = 0.001f;
+
+    //==============================================================================
+    /** Sets up a segment that takes numSamples to travel a distance of height to endLevel. */
+    void setSegment (Segment segment, int voice, double numSamples, float endLevel, float height, float targetRatio) noexcept
+    {
+        const float direction = (segment == attackSegment ? 1.0f : -1.0f);
+
+        targets[segment][voice] = endLevel + direction * jmax (height, 1.0e-3f) * targetRatio;
+        coefficients[segment][voice] = numSamples >= 1.0 ? static_cast<float> (std::exp (-std::log ((1.0 + targetRatio) / targetRatio) / numSamples))
+                                                         : 0.0f;
+    }
+
+    /** Renders the current stage until it ends or the samples run out, and returns how many were done. */
+    int renderStage (int voice, float* dest, int numSamples) noexcept
+    {
+        const int stage = stages[voice];
+        const Segment segment = (stage == attack ? attackSegment : (stage == decay ? decaySegment : releaseSegment));
+        const float endLevel = (stage == attack ? 1.0f : (stage == decay ? sustainLevels[voice] : 0.0f));
+        const float target = targets[segment][voice];
+        const float coefficient = coefficients[segment][voice];
+        const float distance = levels[voice] - target;
+
+        // a zero-length stage, or one that has already reached its end level, ends straight away
+        const bool hasEnded = (stage == attack ? levels[voice] >= endLevel : levels[voice] <= endLevel);
+        double numToEnd = 0.0;
+
+        if (coefficient > 0.0f && ! hasEnded)
+            numToEnd = jmax (1.0, std::ceil (std::log (static_cast<double> ((endLevel - target) / distance))
+                                               / std::log (static_cast<double> (coefficient))));
+
+        const int numToRender = static_cast<int> (jmin (static_cast<double> (numSamples), numToEnd));
+
+        if (numToRender > 0)
+            levels[voice] = target + fillExponential (dest, numToRender, target, distance, coefficient);
+
+        if (numToRender == numToEnd)
+        {
+            levels[voice] = endLevel;
+            stages[voice] = static_cast<uint8> (stage == attack ? decay : (stage == decay ? sustain : idle));
+
+            // a decay straight to a sustain of zero is over
+            if (stages[voice] == sustain && endLevel <= 0.0f)
+                stages[voice] = idle;
+        }
+
+        return numToRender;
+    }
+
+    /** Writes target + distance * coefficient^(i + 1) for each sample, and returns the final distance. */
+    static float fillExponential (float* dest, int numSamples, float target, float distance, float coefficient) noexcept
+    {
+        int i = 0;
+        float d = distance * coefficient;
+
+       #if JUCE_INTEL || defined (__ARM_NEON__) || defined (__ARM_NEON)
+        if (numSamples >= 4)
+        {
+            const float c2 = coefficient * coefficient;
+            const float c4 = c2 * c2;
+            const float initial[4] = { d, d * coefficient, d * c2, d * c2 * coefficient };
+
+          #if JUCE_INTEL
+            __m128 ds = _mm_loadu_ps (initial);
+            const __m128 step = _mm_set1_ps (c4);
+            const __m128 t = _mm_set1_ps (target);
+
+            for (; i + 4 <= numSamples; i += 4)
+            {
+                _mm_storeu_ps (dest + i, _mm_add_ps (t, ds));
+                ds = _mm_mul_ps (ds, step);
+            }
+
+            float lanes[4];
+            _mm_storeu_ps (lanes, ds);
+          #else
+            float32x4_t ds = vld1q_f32 (initial);
+            const float32x4_t t = vdupq_n_f32 (target);
+
+            for (; i + 4 <= numSamples; i += 4)
+            {
+                vst1q_f32 (dest + i, vaddq_f32 (t, ds));
+                ds = vmulq_n_f32 (ds, c4);
+            }
+
+            float lanes[4];
+            vst1q_f32 (lanes, ds);
+          #endif
+
+            d = lanes[0];
+        }
+       #endif
+
+        for (; i < numSamples; ++i)
+        {
+            dest[i] = target + d;
+            d *= coefficient;
+        }
+
+        return d / coefficient;
+    }
+
+    //==============================================================================
+    int numVoices = 0, maxBlockSize = 0;
+
+    HeapBlock<uint8> stages;
+    HeapBlock<float> levels, sustainLevels;
+    HeapBlock<float> coefficients[numSegments], targets[numSegments];
+    HeapBlock<int> numActiveSamples;
+    HeapBlock<bool> isSustaining;
+    HeapBlock<float> gains;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (VoiceEnvelopeBank)
+};
+
+#endif // VOICEENVELOPEBANK_H_INCLUDED
@@ -0,0 +1,174 @@
+/*
+  ==============================================================================
+
+    Copyright (c) 2015 - ROLI Ltd.
+
+  ==============================================================================
+*/
+
+#ifndef VOICERENDERKERNELS_H_INCLUDED
+#define VOICERENDERKERNELS_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+//==============================================================================
+/** The inner loops that mix a run of sample data into a voice's output.
+
+    Each kernel is specialised at compile time on the source and output channel
+    counts, the interpolation type and whether the envelope level is constant or
+    read from an array of gains, so its loop body has no branches. Everything that would otherwise
+    be checked per sample (loop wrap, end of sample, envelope stage changes) is
+    worked out by the caller, which splits the block into runs where none of
+    those things happen and looks up the right kernel for each run.
+*/
+struct VoiceRenderKernels
+{
+    //==============================================================================
+    enum Interpolation
+    {
+        noInterpolation = 0,    // the read position is a whole number and advances by exactly one sample
+        linearInterpolation,
+        numInterpolationTypes
+    };
+
+    enum EnvelopeStage
+    {
+        constantLevel = 0,      // sustaining
+        envelopeGains,          // attacking, decaying or releasing, with a gain per sample
+        numEnvelopeStages
+    };
+
+    //==============================================================================
+    struct Params
+    {
+        const float* inL;
+        const float* inR;
+        float* outL;
+        float* outR;
+        double position;        // read position, relative to inL and inR
+        double pitchRatio;
+        float gainL, gainR;
+        float level;
+        const float* levels;    // the envelope's gains, one per output sample
+    };
+
+    typedef void (*Kernel) (const Params&, int numSamples);
+
+    //==============================================================================
+    static Kernel getKernel (int numSourceChannels, int numOutputChannels,
+                             Interpolation interpolation, EnvelopeStage envelope) noexcept
+    {
+        #define VOICE_RENDER_KERNELS(src, out) \
+            { { &render<src, out, noInterpolation, constantLevel>,     &render<src, out, noInterpolation, envelopeGains> }, \
+              { &render<src, out, linearInterpolation, constantLevel>, &render<src, out, linearInterpolation, envelopeGains> } }
+
+        static const Kernel kernels[2][2][numInterpolationTypes][numEnvelopeStages] =
+        {
+            { VOICE_RENDER_KERNELS (1, 1), VOICE_RENDER_KERNELS (1, 2) },
+            { VOICE_RENDER_KERNELS (2, 1), VOICE_RENDER_KERNELS (2, 2) }
+        };
+
+        #undef VOICE_RENDER_KERNELS
+
+        jassert (numSourceChannels >= 1 && numSourceChannels <= 2);
+        jassert (numOutputChannels >= 1 && numOutputChannels <= 2);
+
+        return kernels[numSourceChannels - 1][numOutputChannels - 1][interpolation][envelope];
+    }
+
+    //==============================================================================
+    template <int numSourceChannels, int numOutputChannels, Interpolation interpolation, EnvelopeStage envelope>
+    static void render (const Params& p, int numSamples) noexcept
+    {
+        const float* const inL = p.inL;
+        const float* const inR = (numSourceChannels > 1 ? p.inR : p.inL);
+        float* const outL = p.outL;
+        float* const outR = (numOutputChannels > 1 ? p.outR : p.outL);
+        const int firstIndex = static_cast<int> (p.position);
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            float l, r;
+
+            if (interpolation == noInterpolation)
+            {
+                l = inL[firstIndex + i];
+                r = inR[firstIndex + i];
+            }
+            else
+            {
+                const double position = p.position + i * p.pitchRatio;
+                const int pos = static_cast<int> (position);
+                const float alpha = static_cast<float> (position - pos);
+                const float invAlpha = 1.0f - alpha;
+
+                l = inL[pos] * invAlpha + inL[pos + 1] * alpha;
+                r = inR[pos] * invAlpha + inR[pos + 1] * alpha;
+            }
+
+            const float level = (envelope == envelopeGains ? p.levels[i] : p.level);
+
+            l *= p.gainL * level;
+            r *= p.gainR * level;
+
+            if (numOutputChannels > 1)
+            {
+                outL[i] += l;
+                outR[i] += r;
+            }
+            else
+            {
+                outL[i] += (l + r) * 0.5f;
+            }
+        }
+    }
+
+    //==============================================================================
+    /** A single loop that makes every one of the kernels' decisions at run time,
+        for each sample. The benchmark uses it as the baseline the kernels are
+        measured and checked against.
+    */
+    static void renderGeneric (const Params& p, int numSamples, int numSourceChannels, int numOutputChannels,
+                               Interpolation interpolation, EnvelopeStage envelope) noexcept
+    {
+        double position = p.position;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const int pos = static_cast<int> (position);
+            const float alpha = (interpolation == linearInterpolation ? static_cast<float> (position - pos) : 0.0f);
+            const float invAlpha = 1.0f - alpha;
+
+            float l = p.inL[pos] * invAlpha + p.inL[pos + 1] * alpha;
+            float r = (numSourceChannels > 1) ? (p.inR[pos] * invAlpha + p.inR[pos + 1] * alpha) : l;
+
+            l *= p.gainL;
+            r *= p.gainR;
+
+            if (envelope == envelopeGains)
+            {
+                l *= p.levels[i];
+                r *= p.levels[i];
+            }
+            else
+            {
+                l *= p.level;
+                r *= p.level;
+            }
+
+            if (numOutputChannels > 1)
+            {
+                p.outL[i] += l;
+                p.outR[i] += r;
+            }
+            else
+            {
+                p.outL[i] += (l + r) * 0.5f;
+            }
+
+            position += (interpolation == linearInterpolation ? p.pitchRatio : 1.0);
+        }
+    }
+};
+
+#endif // VOICERENDERKERNELS_H_INCLUDED
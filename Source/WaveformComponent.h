@@ -0,0 +1,166 @@
+/*
+  ==============================================================================
+
+    Copyright (c) 2015 - ROLI Ltd.
+
+  ==============================================================================
+*/
+
+#ifndef WAVEFORMCOMPONENT_H_INCLUDED
+#define WAVEFORMCOMPONENT_H_INCLUDED
+
+#include "AndroidSynthProcessor.h"
+
+//==============================================================================
+/** Shows the waveform of the recording part's sound, with a line where each of
+    its voices is playing. While a recording is in progress it shows that
+    instead, growing as it's recorded.
+
+    The waveform is drawn from WaveformPeaks, so painting takes the same time
+    at any zoom level. The playheads are polled from the audio thread's
+    published positions and the component only repaints when something moved.
+*/
+class WaveformComponent   : public Component,
+                            private Timer
+{
+public:
+    //==========================================================================
+    WaveformComponent (AudioProcessorPlayer& processorPlayer)
+        : player (processorPlayer)
+    {
+        setOpaque (true);
+        startTimerHz (kRefreshRateHz);
+    }
+
+    //==========================================================================
+    /** Zooms to show this range of samples. An empty range shows everything. */
+    void setVisibleRange (Range<double> newRange)
+    {
+        visibleRange = newRange;
+        repaint();
+    }
+
+    Range<double> getVisibleRange() const noexcept                  { return visibleRange; }
+
+    //==========================================================================
+    void paint (Graphics& g) override
+    {
+        g.fillAll (findColour (ResizableWindow::backgroundColourId));
+
+        const WaveformPeaks* const peaks = getPeaksToShow();
+        const int width = getWidth();
+
+        if (peaks == nullptr || width <= 0 || peakBuffer == nullptr)
+            return;
+
+        const Range<double> range = getRangeToShow (*peaks);
+        const double samplesPerPixel = range.getLength() / width;
+        const float centre = getHeight() * 0.5f;
+
+        peaks->getPeaks (range.getStart(), samplesPerPixel, peakBuffer, width);
+
+        g.setColour (findColour (TextButton::buttonOnColourId));
+
+        for (int x = 0; x < width; ++x)
+            g.drawVerticalLine (x, centre - jmin (1.0f, peakBuffer[x].high) * centre,
+                                   centre - jmax (-1.0f, peakBuffer[x].low) * centre + 1.0f);
+
+        g.setColour (Colours::white);
+
+        for (int i = 0; i < numPlayheads; ++i)
+        {
+            const int x = static_cast<int> ((playheads[i] - range.getStart()) / samplesPerPixel);
+
+            if (isPositiveAndBelow (x, width))
+                g.drawVerticalLine (x, 0.0f, (float) getHeight());
+        }
+    }
+
+    void resized() override
+    {
+        peakBuffer.malloc (static_cast<size_t> (jmax (1, getWidth())));
+    }
+
+private:
+    //==========================================================================
+    void timerCallback() override
+    {
+        AndroidSynthProcessor* const processor = getProcessor();
+
+        if (processor == nullptr)
+            return;
+
+        const bool isRecordingNow = processor->isRecording();
+        const int partIndex = processor->getRecordingTargetPart();
+        const SynthesiserSound::Ptr soundNow (processor->getPartSound (partIndex));
+
+        int newPlayheads[kMaxNumPlayheads];
+        const int numNewPlayheads = isRecordingNow ? 0 : processor->getPartPlayheadPositions (partIndex, newPlayheads, kMaxNumPlayheads);
+
+        bool needsRepaint = isRecordingNow || wasRecording
+                              || soundNow != sound
+                              || numNewPlayheads != numPlayheads;
+
+        for (int i = 0; i < numNewPlayheads && ! needsRepaint; ++i)
+            needsRepaint = (newPlayheads[i] != playheads[i]);
+
+        wasRecording = isRecordingNow;
+        sound = soundNow;
+        numPlayheads = numNewPlayheads;
+        std::copy (newPlayheads, newPlayheads + numNewPlayheads, playheads);
+
+        if (needsRepaint)
+            repaint();
+    }
+
+    //==========================================================================
+    AndroidSynthProcessor* getProcessor() const
+    {
+        return dynamic_cast<AndroidSynthProcessor*> (player.getCurrentProcessor());
+    }
+
+    const WaveformPeaks* getPeaksToShow() const
+    {
+        if (wasRecording)
+            if (const AndroidSynthProcessor* const processor = getProcessor())
+                return &processor->getRecordingPeaks();
+
+        if (const CompactSamplerSound* const compactSound = dynamic_cast<const CompactSamplerSound*> (sound.get()))
+            return &compactSound->getPeaks();
+
+        return nullptr;
+    }
+
+    /** A recording in progress is shown at its full length so that it fills up
+        from the left; a sound is shown across its whole length unless zoomed.
+    */
+    Range<double> getRangeToShow (const WaveformPeaks& peaks) const
+    {
+        if (wasRecording)
+            return Range<double> (0.0, (double) jmax (1, peaks.getMaxNumSamples()));
+
+        if (visibleRange.isEmpty())
+            return Range<double> (0.0, (double) jmax (1, peaks.getNumSamples()));
+
+        return visibleRange;
+    }
+
+    //==========================================================================
+    static constexpr int kRefreshRateHz = 30;
+    static constexpr int kMaxNumPlayheads = 32;
+
+    AudioProcessorPlayer& player;
+
+    SynthesiserSound::Ptr sound;
+    bool wasRecording = false;
+    int playheads[kMaxNumPlayheads];
+    int numPlayheads = 0;
+
+    Range<double> visibleRange;
+    HeapBlock<WaveformPeaks::Peak> peakBuffer;
+
+    //==========================================================================
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (WaveformComponent)
+};
+
+#endif  // WAVEFORMCOMPONENT_H_INCLUDED
@@ -0,0 +1,224 @@
+/*
+  ==============================================================================
+
+    Copyright (c) 2015 - ROLI Ltd.
+
+  ==============================================================================
+*/
+
+#ifndef WAVEFORMPEAKS_H_INCLUDED
+#define WAVEFORMPEAKS_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+
+//==============================================================================
+/** A min/max pyramid of a sample, for drawing its waveform at any zoom level.
+
+    The bottom level holds the peaks of each block of kBaseBlockSize samples,
+    and every level above it merges pairs of entries from the one below. To
+    draw N pixels, getPeaks() picks the level whose blocks are just under a
+    pixel wide and combines at most three entries per pixel, so the cost
+    depends on the width in pixels rather than on the number of samples shown.
+
+    Samples can be appended by one thread (the audio thread, while recording)
+    while another thread reads the peaks. Storage is allocated up front by
+    setMaxNumSamples(), and the number of samples covered is only published
+    after their peaks have been written.
+*/
+class WaveformPeaks
+{
+public:
+    //==============================================================================
+    struct Peak
+    {
+        float low, high;
+    };
+
+    //==============================================================================
+    WaveformPeaks() noexcept {}
+
+    /** Allocates room for this many samples. This must not be called while
+        samples are being added or peaks read.
+    */
+    void setMaxNumSamples (int newMaxNumSamples)
+    {
+        clear();
+        reserve (newMaxNumSamples);
+        maxNumSamples = newMaxNumSamples;
+    }
+
+    /** Allocates room for this many samples without changing the maximum, so
+        that later calls to setMaxNumSamples() or setSamples() that fit within
+        it don't allocate. The same restrictions apply as for setMaxNumSamples().
+    */
+    void reserve (int numSamplesToAllowFor)
+    {
+        if (numSamplesToAllowFor <= capacity)
+            return;
+
+        capacity = numSamplesToAllowFor;
+        numLevels = 0;
+
+        int totalEntries = 0;
+
+        for (int entries = getNumEntries (capacity, 0); numLevels < kMaxNumLevels; entries = (entries + 1) / 2)
+        {
+            levelOffsets[numLevels++] = totalEntries;
+            totalEntries += entries;
+
+            if (entries <= 1)
+                break;
+        }
+
+        peaks.malloc (static_cast<size_t> (totalEntries));
+    }
+
+    void clear() noexcept                                           { numSamples.set (0); }
+
+    /** Replaces the contents with the peaks of these samples. */
+    void setSamples (const float* samples, int numSamplesToUse)
+    {
+        setMaxNumSamples (numSamplesToUse);
+        addSamples (samples, numSamplesToUse);
+    }
+
+    /** Appends samples, updating every level of the pyramid that covers them.
+        This doesn't allocate, so it can be called from the audio thread.
+    */
+    void addSamples (const float* samples, int numToAdd) noexcept
+    {
+        const int start = numSamples.get();
+        const int end = jmin (maxNumSamples, start + numToAdd);
+
+        if (end <= start)
+            return;
+
+        // the bottom level takes the min and max of each block directly from the samples
+        for (int pos = start; pos < end;)
+        {
+            const int block = pos / kBaseBlockSize;
+            const int blockEnd = jmin (end, (block + 1) * kBaseBlockSize);
+            const Range<float> range (FloatVectorOperations::findMinAndMax (samples + (pos - start), blockEnd - pos));
+
+            Peak& peak = peaks[levelOffsets[0] + block];
+
+            if (pos == block * kBaseBlockSize)
+            {
+                peak.low = range.getStart();
+                peak.high = range.getEnd();
+            }
+            else
+            {
+                peak.low = jmin (peak.low, range.getStart());
+                peak.high = jmax (peak.high, range.getEnd());
+            }
+
+            pos = blockEnd;
+        }
+
+        // each level above merges the pairs of entries below it that have changed
+        for (int level = 1; level < numLevels; ++level)
+        {
+            const int firstEntry = getEntryIndex (start, level);
+            const int lastEntry = getEntryIndex (end - 1, level);
+            const int numEntriesBelow = getNumEntries (end, level - 1);
+            const Peak* const below = peaks + levelOffsets[level - 1];
+
+            for (int i = firstEntry; i <= lastEntry; ++i)
+            {
+                Peak merged = below[2 * i];
+
+                if (2 * i + 1 < numEntriesBelow)
+                {
+                    merged.low = jmin (merged.low, below[2 * i + 1].low);
+                    merged.high = jmax (merged.high, below[2 * i + 1].high);
+                }
+
+                peaks[levelOffsets[level] + i] = merged;
+            }
+        }
+
+        numSamples.set (end);
+    }
+
+    //==============================================================================
+    int getNumSamples() const noexcept                              { return numSamples.get(); }
+    int getMaxNumSamples() const noexcept                           { return maxNumSamples; }
+
+    /** Fills dest with the peaks of numPixels consecutive ranges of
+        samplesPerPixel samples, starting at startSample. Pixels beyond the
+        samples that have been added get an empty peak of zero.
+    */
+    void getPeaks (double startSample, double samplesPerPixel, Peak* dest, int numPixels) const noexcept
+    {
+        const int available = numSamples.get();
+
+        if (numLevels == 0)
+        {
+            for (int x = 0; x < numPixels; ++x)
+                dest[x].low = dest[x].high = 0.0f;
+
+            return;
+        }
+
+        const int level = getLevelForBlockSize (samplesPerPixel);
+        const int blockSize = kBaseBlockSize << level;
+        const Peak* const levelPeaks = peaks + levelOffsets[level];
+
+        for (int x = 0; x < numPixels; ++x)
+        {
+            const int first = jmax (0, static_cast<int> (startSample + x * samplesPerPixel));
+            const int last = jmin (available, static_cast<int> (startSample + (x + 1) * samplesPerPixel)) - 1;
+
+            Peak peak = { 0.0f, 0.0f };
+
+            if (last >= first)
+            {
+                peak = levelPeaks[first / blockSize];
+
+                for (int i = first / blockSize + 1; i <= last / blockSize; ++i)
+                {
+                    peak.low = jmin (peak.low, levelPeaks[i].low);
+                    peak.high = jmax (peak.high, levelPeaks[i].high);
+                }
+            }
+
+            dest[x] = peak;
+        }
+    }
+
+private:
+    //==============================================================================
+    static constexpr int kBaseBlockSize = 8;
+    static constexpr int kMaxNumLevels = 24;
+
+    static int getNumEntries (int numSamplesCovered, int level) noexcept
+    {
+        const int blockSize = kBaseBlockSize << level;
+        return (numSamplesCovered + blockSize - 1) / blockSize;
+    }
+
+    static int getEntryIndex (int sample, int level) noexcept     { return sample / (kBaseBlockSize << level); }
+
+    /** Returns the highest level whose blocks are no wider than samplesPerPixel. */
+    int getLevelForBlockSize (double samplesPerPixel) const noexcept
+    {
+        int level = 0;
+
+        while (level + 1 < numLevels && (kBaseBlockSize << (level + 1)) <= samplesPerPixel)
+            ++level;
+
+        return level;
+    }
+
+    //==============================================================================
+    HeapBlock<Peak> peaks;
+    int levelOffsets[kMaxNumLevels];
+    int numLevels = 0;
+    int maxNumSamples = 0, capacity = 0;
+    Atomic<int> numSamples;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (WaveformPeaks)
+};
+
+#endif // WAVEFORMPEAKS_H_INCLUDED